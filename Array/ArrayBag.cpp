@@ -12,23 +12,125 @@
 #include "ArrayBag.hpp"
 
 /**
- * @brief Parameterized Constructor
+ * @brief default constructor
  */
-template <class ItemType>
-ArrayBag<ItemType>::ArrayBag() : item_count_{0}, array_capacity_{DEFAULT_ARRAY_SIZE_}
+template <class ItemType, int InlineCapacity>
+ArrayBag<ItemType, InlineCapacity>::ArrayBag() : item_count_{0}, ordered_{true}, memory_resource_{std::pmr::get_default_resource()}
 {
-    elements_ = std::shared_ptr<ItemType[]>(new ItemType[array_capacity_]);
+    initializeStorage(DEFAULT_ARRAY_SIZE_);
+}
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param memory_resource to allocate every heap buffer from
+ */
+template <class ItemType, int InlineCapacity>
+ArrayBag<ItemType, InlineCapacity>::ArrayBag(std::pmr::memory_resource *memory_resource) : item_count_{0}, ordered_{true}, memory_resource_{memory_resource}
+{
+    initializeStorage(DEFAULT_ARRAY_SIZE_);
 }
 
 /**
  * @brief parameterized constructor
  *
  * @param array_size whose value will determine the capacity of the array size at instantiation time
+ * @param memory_resource to allocate every heap buffer from
+ */
+template <class ItemType, int InlineCapacity>
+ArrayBag<ItemType, InlineCapacity>::ArrayBag(const int &array_size, std::pmr::memory_resource *memory_resource) : item_count_{0}, ordered_{true}, memory_resource_{memory_resource}
+{
+    initializeStorage(array_size);
+}
+
+/**
+ * @brief copy constructor
+ *
+ * @param a_bag whose heap buffer is shared copy-on-write (inline entries are copied right away)
+ * @note the copy allocates from the same memory resource as a_bag, since it may share a_bag's buffer
+ */
+template <class ItemType, int InlineCapacity>
+ArrayBag<ItemType, InlineCapacity>::ArrayBag(const ArrayBag<ItemType, InlineCapacity> &a_bag) : item_count_{0}, ordered_{a_bag.ordered_}, memory_resource_{a_bag.memory_resource_}
+{
+    if (a_bag.heap_ != nullptr)
+    {
+        // Share the buffer - whichever bag is modified first clones it
+        a_bag.publishCount();
+        heap_ = a_bag.heap_;
+        elements_ = heap_->elements;
+        array_capacity_ = a_bag.array_capacity_;
+        item_count_ = a_bag.item_count_;
+        return;
+    }
+
+    initializeStorage(a_bag.array_capacity_);
+    try
+    {
+        std::uninitialized_copy(a_bag.elements_, a_bag.elements_ + a_bag.item_count_, elements_);
+    }
+    catch (...)
+    {
+        releaseStorage();
+        throw;
+    }
+    item_count_ = a_bag.item_count_;
+}
+
+/**
+ * @brief move constructor
+ *
+ * @param a_bag whose buffer is taken over (or whose inline entries are moved), leaving it empty
+ */
+template <class ItemType, int InlineCapacity>
+ArrayBag<ItemType, InlineCapacity>::ArrayBag(ArrayBag<ItemType, InlineCapacity> &&a_bag) noexcept(IS_NOTHROW_MOVABLE_) : item_count_{0}, ordered_{a_bag.ordered_}, memory_resource_{a_bag.memory_resource_}
+{
+    takeStorageOf(a_bag);
+}
+
+/**
+ * @brief destructor - destroys every entry and releases the buffer, unless a copy still shares it
  */
-template <class ItemType>
-ArrayBag<ItemType>::ArrayBag(const int &array_size) : item_count_{0}, array_capacity_{array_size}
+template <class ItemType, int InlineCapacity>
+ArrayBag<ItemType, InlineCapacity>::~ArrayBag()
 {
-    elements_ = std::shared_ptr<ItemType[]>(new ItemType[array_capacity_]);
+    releaseStorage();
+}
+
+/**
+ * @brief copy assignment operator
+ *
+ * @param a_bag whose heap buffer is shared copy-on-write (inline entries are copied right away)
+ * @return a reference to this bag
+ */
+template <class ItemType, int InlineCapacity>
+ArrayBag<ItemType, InlineCapacity> &ArrayBag<ItemType, InlineCapacity>::operator=(const ArrayBag<ItemType, InlineCapacity> &a_bag)
+{
+    if (this != &a_bag)
+    {
+        // Copy first so that this bag is left untouched if copying throws
+        ArrayBag<ItemType, InlineCapacity> copy(a_bag);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+/**
+ * @brief move assignment operator
+ *
+ * @param a_bag whose buffer is taken over (or whose inline entries are moved), leaving it empty
+ * @return a reference to this bag
+ */
+template <class ItemType, int InlineCapacity>
+ArrayBag<ItemType, InlineCapacity> &ArrayBag<ItemType, InlineCapacity>::operator=(ArrayBag<ItemType, InlineCapacity> &&a_bag) noexcept(IS_NOTHROW_MOVABLE_)
+{
+    if (this != &a_bag)
+    {
+        // The buffer knows which resource it came from, so this bag keeps allocating from its own
+        releaseStorage();
+        takeStorageOf(a_bag);
+        ordered_ = a_bag.ordered_;
+    }
+    return *this;
 }
 
 /**
@@ -36,8 +138,8 @@ ArrayBag<ItemType>::ArrayBag(const int &array_size) : item_count_{0}, array_capa
  *
  * @return the current size of the bag
  */
-template <class ItemType>
-int ArrayBag<ItemType>::getCurrentSize() const
+template <class ItemType, int InlineCapacity>
+int ArrayBag<ItemType, InlineCapacity>::getCurrentSize() const
 {
     return item_count_;
 }
@@ -47,8 +149,8 @@ int ArrayBag<ItemType>::getCurrentSize() const
  *
  * @return the current capacity of elements_
  */
-template <class ItemType>
-int ArrayBag<ItemType>::getCurrentCapacity() const
+template <class ItemType, int InlineCapacity>
+int ArrayBag<ItemType, InlineCapacity>::getCurrentCapacity() const
 {
     return array_capacity_;
 }
@@ -59,21 +161,10 @@ int ArrayBag<ItemType>::getCurrentCapacity() const
  * @param an_entry whose intances in elements_ are to be counted up
  * @return int - the number of times an_entry is found
  */
-template <class ItemType>
-int ArrayBag<ItemType>::getFrequencyOf(const ItemType &an_entry) const
+template <class ItemType, int InlineCapacity>
+int ArrayBag<ItemType, InlineCapacity>::getFrequencyOf(const ItemType &an_entry) const
 {
-    int frequency = 0;
-    int curr_index = 0;
-    while (curr_index < item_count_)
-    {
-        if (elements_[curr_index] == an_entry)
-        {
-            frequency++;
-        }
-        curr_index++;
-    }
-
-    return frequency;
+    return getFrequencyIn(0, item_count_, an_entry);
 }
 
 /**
@@ -82,8 +173,8 @@ int ArrayBag<ItemType>::getFrequencyOf(const ItemType &an_entry) const
  * @return true if item_count_ == 0,
  * @return false otherwise
  */
-template <class ItemType>
-bool ArrayBag<ItemType>::isEmpty() const
+template <class ItemType, int InlineCapacity>
+bool ArrayBag<ItemType, InlineCapacity>::isEmpty() const
 {
     return item_count_ == 0;
 }
@@ -95,49 +186,152 @@ bool ArrayBag<ItemType>::isEmpty() const
  * @return true if an_entry is found in elements_,
  * @return false otherwise
  */
-template <class ItemType>
-bool ArrayBag<ItemType>::contains(const ItemType &an_entry) const
+template <class ItemType, int InlineCapacity>
+bool ArrayBag<ItemType, InlineCapacity>::contains(const ItemType &an_entry) const
 {
     return getIndexOf(an_entry) > -1;
 }
 
+/**
+ * @brief gets the frequency of an object, counting on several threads at once
+ *
+ * @param an_entry whose intances in elements_ are to be counted up
+ * @param thread_count the most threads to use - 0 means one per hardware thread
+ * @note bags smaller than PARALLEL_THRESHOLD_ are counted on the calling thread alone
+ * @return the number of times an_entry is found
+ */
+template <class ItemType, int InlineCapacity>
+int ArrayBag<ItemType, InlineCapacity>::getFrequencyOfParallel(const ItemType &an_entry, const int &thread_count) const
+{
+    int worker_count = getWorkerCount(thread_count);
+    if (worker_count <= 1)
+    {
+        return getFrequencyOf(an_entry);
+    }
+
+    int block_count = (item_count_ - 1) / PARALLEL_BLOCK_SIZE_ + 1;
+    std::atomic<int> frequency{0};
+    TaskRunner::run(worker_count, [&](const size_t &worker)
+                    {
+        // Deal the blocks out round-robin and only touch the shared total once per worker
+        int worker_frequency = 0;
+        for (int block = static_cast<int>(worker); block < block_count; block += worker_count)
+        {
+            int first = block * PARALLEL_BLOCK_SIZE_;
+            worker_frequency += getFrequencyIn(first, std::min(first + PARALLEL_BLOCK_SIZE_, item_count_), an_entry);
+        }
+        frequency.fetch_add(worker_frequency, std::memory_order_relaxed); });
+
+    return frequency.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief locates an_entry, searching on several threads at once
+ *
+ * @param an_entry to be located in elements_
+ * @param thread_count the most threads to use - 0 means one per hardware thread
+ * @note bags smaller than PARALLEL_THRESHOLD_ are searched on the calling thread alone
+ * @return true if an_entry is found in elements_,
+ * @return false otherwise
+ */
+template <class ItemType, int InlineCapacity>
+bool ArrayBag<ItemType, InlineCapacity>::containsParallel(const ItemType &an_entry, const int &thread_count) const
+{
+    return getIndexOfParallel(an_entry, thread_count) > -1;
+}
+
 /**
  * @brief adds new_entry at the end of elements_
  *
  * @param new_entry to insert into elements_
  * @return true as long as there is available RAM on the system since the array's size can increase
  */
-template <class ItemType>
-bool ArrayBag<ItemType>::push_back(const ItemType &new_entry)
+template <class ItemType, int InlineCapacity>
+bool ArrayBag<ItemType, InlineCapacity>::push_back(const ItemType &new_entry)
+{
+    emplace_back(new_entry);
+    return true;
+}
+
+/**
+ * @brief moves new_entry to the end of elements_
+ *
+ * @param new_entry to be moved to the back of elements_
+ * @return true as long as there is available RAM on the system since the array's size can increase
+ */
+template <class ItemType, int InlineCapacity>
+bool ArrayBag<ItemType, InlineCapacity>::push_back(ItemType &&new_entry)
 {
-    if (item_count_ >= array_capacity_)
+    emplace_back(std::move(new_entry));
+    return true;
+}
+
+/**
+ * @brief constructs a new entry in place at the back of elements_
+ *
+ * @param args to be forwarded to the constructor of ItemType
+ * @return a reference to the new entry
+ */
+template <class ItemType, int InlineCapacity>
+template <class... Args>
+ItemType &ArrayBag<ItemType, InlineCapacity>::emplace_back(Args &&...args)
+{
+    if (item_count_ >= array_capacity_ || isShared())
     {
-        // Double the array capacity
-        array_capacity_ = array_capacity_ << 1;
+        // Double the array capacity (or just clone the buffer if it is shared but has room)
+        int new_capacity = item_count_ >= array_capacity_ ? getGrownCapacity() : array_capacity_;
+        std::shared_ptr<HeapBuffer> new_heap = makeHeapBuffer(new_capacity);
 
-        // Allocate new space
-        std::shared_ptr<ItemType[]> new_elements = std::shared_ptr<ItemType[]>(new ItemType[array_capacity_]);
+        // Construct the new entry first, since args may refer to an entry of the old array
+        ::new (static_cast<void *>(new_heap->elements + item_count_)) ItemType(std::forward<Args>(args)...);
 
-        // Copy contents of old array into new array
-        for (int i = 0; i < item_count_; i++)
+        // Move contents of old array into new array, then release the old array
+        try
+        {
+            transferStorage(new_heap, new_heap->elements, new_capacity);
+        }
+        catch (...)
         {
-            new_elements[i] = elements_[i];
+            new_heap->elements[item_count_].~ItemType();
+            throw;
         }
+    }
+    else
+    {
+        ::new (static_cast<void *>(elements_ + item_count_)) ItemType(std::forward<Args>(args)...);
+    }
 
-        // Add new_entry at the back of the new array and update item_count_
-        new_elements[item_count_] = new_entry;
-        item_count_++;
+    item_count_++;
+    return elements_[item_count_ - 1];
+}
 
-        // Deallocate the old array and replace it with the new array
-        elements_ = new_elements;
+/**
+ * @brief makes sure elements_ can hold at least new_capacity entries without growing again
+ *
+ * @param new_capacity the minimum capacity of elements_
+ * @post the capacity is unchanged if it was already at least new_capacity
+ */
+template <class ItemType, int InlineCapacity>
+void ArrayBag<ItemType, InlineCapacity>::reserve(const int &new_capacity)
+{
+    if (new_capacity > array_capacity_)
+    {
+        reallocate(new_capacity);
     }
-    else
+}
+
+/**
+ * @brief releases any capacity of elements_ beyond the current size of the bag
+ *
+ * @post the capacity of elements_ equals item_count_, or InlineCapacity if the entries fit in the inline buffer
+ */
+template <class ItemType, int InlineCapacity>
+void ArrayBag<ItemType, InlineCapacity>::shrink_to_fit()
+{
+    if (item_count_ < array_capacity_ && !isInline())
     {
-        // Add new_entry at the back of the new array and update item_count_
-        elements_[item_count_] = new_entry;
-        item_count_++;
+        reallocate(item_count_);
     }
-    return true;
 }
 
 /**
@@ -146,8 +340,8 @@ bool ArrayBag<ItemType>::push_back(const ItemType &new_entry)
  * @return true if the last entry in the array was removed,
  * @return false otherwise
  */
-template <class ItemType>
-bool ArrayBag<ItemType>::pop_back()
+template <class ItemType, int InlineCapacity>
+bool ArrayBag<ItemType, InlineCapacity>::pop_back()
 {
     if (isEmpty())
     {
@@ -155,7 +349,10 @@ bool ArrayBag<ItemType>::pop_back()
     }
     else
     {
+        detach();
         item_count_--;
+        elements_[item_count_].~ItemType();
+        return true;
     }
 }
 
@@ -163,34 +360,156 @@ bool ArrayBag<ItemType>::pop_back()
  * @brief finds and removes an_entry from elements_
  *
  * @param an_entry to be removed
+ * @post if the bag is unordered, the last entry of the array is moved to the index of the removed item in O(1),
+ * otherwise every later entry is shifted left by one
  * @return true if an_entry was successfully removed from elements_,
  * @return false otherwise
  */
-template <class ItemType>
-bool ArrayBag<ItemType>::removeInstanceOf(const ItemType &an_entry)
+template <class ItemType, int InlineCapacity>
+bool ArrayBag<ItemType, InlineCapacity>::removeInstanceOf(const ItemType &an_entry)
 {
     int move_index = getIndexOf(an_entry);
     bool can_remove = !isEmpty() && (move_index > -1);
     if (can_remove)
     {
-        for (int i = move_index + 1; i < item_count_; i++)
+        detach();
+        if (!ordered_)
         {
-            elements_[move_index] = elements_[i];
-            move_index++;
+            // Fill the hole with the last entry
+            if (move_index != item_count_ - 1)
+            {
+                elements_[move_index] = std::move(elements_[item_count_ - 1]);
+            }
+        }
+        else
+        {
+            for (int i = move_index + 1; i < item_count_; i++)
+            {
+                elements_[move_index] = std::move(elements_[i]);
+                move_index++;
+            }
         }
         item_count_--;
+        elements_[item_count_].~ItemType();
     }
     return can_remove;
 }
 
+/**
+ * @brief removes every instance of an_entry from elements_ in a single pass
+ *
+ * @param an_entry to be removed
+ * @return the number of entries removed
+ */
+template <class ItemType, int InlineCapacity>
+int ArrayBag<ItemType, InlineCapacity>::removeAllInstancesOf(const ItemType &an_entry)
+{
+    return remove_if([&an_entry](const ItemType &item)
+                     { return item == an_entry; });
+}
+
+/**
+ * @brief removes every entry for which predicate returns true in a single pass
+ *
+ * @param predicate to be called once on each entry
+ * @post if the bag is ordered, the remaining entries keep their relative order
+ * @return the number of entries removed
+ */
+template <class ItemType, int InlineCapacity>
+template <class Predicate>
+int ArrayBag<ItemType, InlineCapacity>::remove_if(Predicate predicate)
+{
+    // Find the first match before touching anything, so that a shared buffer is only cloned if something goes
+    int first_match = 0;
+    while (first_match < item_count_ && !predicate(elements_[first_match]))
+    {
+        first_match++;
+    }
+    if (first_match == item_count_)
+    {
+        return 0;
+    }
+    detach();
+
+    int old_count = item_count_;
+    int keep_count = first_match;
+
+    if (ordered_)
+    {
+        // Compact the kept entries after the first match towards the front
+        for (int i = first_match + 1; i < item_count_; i++)
+        {
+            if (!predicate(elements_[i]))
+            {
+                if (i != keep_count)
+                {
+                    elements_[keep_count] = std::move(elements_[i]);
+                }
+                keep_count++;
+            }
+        }
+    }
+    else
+    {
+        // Pull entries in from the back to fill each hole, so every entry is still only looked at once - starting with
+        // the hole the first match leaves
+        keep_count = item_count_ - 1;
+        if (first_match != keep_count)
+        {
+            elements_[first_match] = std::move(elements_[keep_count]);
+        }
+        int i = first_match;
+        while (i < keep_count)
+        {
+            if (predicate(elements_[i]))
+            {
+                keep_count--;
+                if (i != keep_count)
+                {
+                    elements_[i] = std::move(elements_[keep_count]);
+                }
+            }
+            else
+            {
+                i++;
+            }
+        }
+    }
+
+    // Destroy the moved-from tail
+    for (int i = keep_count; i < old_count; i++)
+    {
+        elements_[i].~ItemType();
+    }
+    item_count_ = keep_count;
+
+    return old_count - keep_count;
+}
+
 /**
  * @brief makes the array empty
  *
- * @post does not actually empty the contents of elements_, but allows for them to be overwritten
+ * @post every entry is destroyed, but the capacity of elements_ is kept for reuse
  */
-template <class ItemType>
-void ArrayBag<ItemType>::clear()
+template <class ItemType, int InlineCapacity>
+void ArrayBag<ItemType, InlineCapacity>::clear()
 {
+    if (isShared())
+    {
+        // Leave the entries to the other owners and start over with a buffer of the same capacity
+        int capacity = array_capacity_;
+        releaseStorage();
+        initializeStorage(capacity);
+        return;
+    }
+
+    if constexpr (!std::is_trivially_destructible<ItemType>::value)
+    {
+        for (int i = 0; i < item_count_; i++)
+        {
+            elements_[i].~ItemType();
+        }
+    }
     item_count_ = 0;
 }
 
@@ -199,10 +518,10 @@ void ArrayBag<ItemType>::clear()
  *
  * @param i is the index in the array
  * @note Bounds-checking is NOT performed -> Be sure to avoid using indexes greater than or equal to item_count_
- * @return a copy of the item at the location specified by the parameter
+ * @return a read-only reference to the item at the location specified by the parameter
  */
-template <class ItemType>
-ItemType ArrayBag<ItemType>::operator[](int i) const
+template <class ItemType, int InlineCapacity>
+const ItemType &ArrayBag<ItemType, InlineCapacity>::operator[](int i) const
 {
     return elements_[i];
 }
@@ -214,14 +533,223 @@ ItemType ArrayBag<ItemType>::operator[](int i) const
  * @note Bounds-checking is NOT performed -> Be sure to avoid using indexes greater than or equal to item_count_
  * @return a reference to the item at the location specified by the parameter
  */
-template <class ItemType>
-ItemType &ArrayBag<ItemType>::operator[](int i)
+template <class ItemType, int InlineCapacity>
+ItemType &ArrayBag<ItemType, InlineCapacity>::operator[](int i)
 {
+    // The caller may write through the reference
+    detach();
     return elements_[i];
 }
 
+/**
+ * @brief gets an iterator to the first entry
+ *
+ * @note the entries may be written through the iterator, so a shared buffer is cloned first
+ * @return a pointer to the first entry of elements_
+ */
+template <class ItemType, int InlineCapacity>
+typename ArrayBag<ItemType, InlineCapacity>::iterator ArrayBag<ItemType, InlineCapacity>::begin()
+{
+    return data();
+}
+
+/**
+ * @brief gets an iterator past the last entry
+ *
+ * @note the entries may be written through the iterator, so a shared buffer is cloned first
+ * @return a pointer past the last entry of elements_
+ */
+template <class ItemType, int InlineCapacity>
+typename ArrayBag<ItemType, InlineCapacity>::iterator ArrayBag<ItemType, InlineCapacity>::end()
+{
+    return data() + item_count_;
+}
+
+/**
+ * @brief gets a read-only iterator to the first entry
+ *
+ * @return a pointer to the first entry of elements_
+ */
+template <class ItemType, int InlineCapacity>
+typename ArrayBag<ItemType, InlineCapacity>::const_iterator ArrayBag<ItemType, InlineCapacity>::begin() const
+{
+    return elements_;
+}
+
+/**
+ * @brief gets a read-only iterator past the last entry
+ *
+ * @return a pointer past the last entry of elements_
+ */
+template <class ItemType, int InlineCapacity>
+typename ArrayBag<ItemType, InlineCapacity>::const_iterator ArrayBag<ItemType, InlineCapacity>::end() const
+{
+    return elements_ + item_count_;
+}
+
+/**
+ * @brief gets a read-only iterator to the first entry
+ *
+ * @return a pointer to the first entry of elements_
+ */
+template <class ItemType, int InlineCapacity>
+typename ArrayBag<ItemType, InlineCapacity>::const_iterator ArrayBag<ItemType, InlineCapacity>::cbegin() const
+{
+    return begin();
+}
+
+/**
+ * @brief gets a read-only iterator past the last entry
+ *
+ * @return a pointer past the last entry of elements_
+ */
+template <class ItemType, int InlineCapacity>
+typename ArrayBag<ItemType, InlineCapacity>::const_iterator ArrayBag<ItemType, InlineCapacity>::cend() const
+{
+    return end();
+}
+
+/**
+ * @brief gets direct access to the underlying array
+ *
+ * @note the entries may be written through the pointer, so a shared buffer is cloned first
+ * @return a pointer to elements_, valid until the bag next grows or shrinks
+ */
+template <class ItemType, int InlineCapacity>
+ItemType *ArrayBag<ItemType, InlineCapacity>::data()
+{
+    detach();
+    return elements_;
+}
+
+/**
+ * @brief gets read-only access to the underlying array
+ *
+ * @return a pointer to elements_, valid until the bag next grows or shrinks
+ */
+template <class ItemType, int InlineCapacity>
+const ItemType *ArrayBag<ItemType, InlineCapacity>::data() const
+{
+    return elements_;
+}
+
+/**
+ * @brief chooses whether removals keep the remaining entries in order
+ *
+ * @param ordered true to shift later entries left on removal, false to fill the hole with the last entry in O(1)
+ */
+template <class ItemType, int InlineCapacity>
+void ArrayBag<ItemType, InlineCapacity>::setOrdered(const bool &ordered)
+{
+    ordered_ = ordered;
+}
+
+/**
+ * @brief checks if removals keep the remaining entries in order
+ *
+ * @return true if the bag is ordered (the default),
+ * @return false otherwise
+ */
+template <class ItemType, int InlineCapacity>
+bool ArrayBag<ItemType, InlineCapacity>::isOrdered() const
+{
+    return ordered_;
+}
+
+/**
+ * @brief takes a frozen view of the bag
+ *
+ * @note O(1) when the entries are on the heap - neither bag copies the buffer until one of them is modified
+ * @note must be called by the thread that modifies the bag (or while holding whatever lock guards it), after which
+ * the snapshot can be read by any thread without further locking
+ * @return a bag holding the current entries
+ */
+template <class ItemType, int InlineCapacity>
+ArrayBag<ItemType, InlineCapacity> ArrayBag<ItemType, InlineCapacity>::snapshot() const
+{
+    return ArrayBag<ItemType, InlineCapacity>(*this);
+}
+
+/**
+ * @brief checks if the heap buffer is shared with a copy or snapshot of this bag
+ *
+ * @note a false result also acquires the buffer from the owners that let go of it, even on other threads - their
+ * reads of it happen before anything the caller then writes to it
+ * @return true if the next modification will clone the buffer,
+ * @return false otherwise
+ */
+template <class ItemType, int InlineCapacity>
+bool ArrayBag<ItemType, InlineCapacity>::isShared() const
+{
+    if (heap_ == nullptr)
+    {
+        return false;
+    }
+    if (heap_.use_count() > 1)
+    {
+        return true;
+    }
+
+    // use_count() is only a relaxed load - pair it with the release of the owners' reference count decrements
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return false;
+}
+
+/**
+ * @brief checks if the entries are stored inside the bag object rather than on the heap
+ *
+ * @return true if elements_ is the inline buffer,
+ * @return false otherwise
+ */
+template <class ItemType, int InlineCapacity>
+bool ArrayBag<ItemType, InlineCapacity>::isInline() const
+{
+    return InlineCapacity > 0 && elements_ == reinterpret_cast<const ItemType *>(inline_elements_);
+}
+
+/**
+ * @brief gets the memory resource the bag allocates its heap buffers from
+ *
+ * @return a pointer to the memory resource
+ */
+template <class ItemType, int InlineCapacity>
+std::pmr::memory_resource *ArrayBag<ItemType, InlineCapacity>::getMemoryResource() const
+{
+    return memory_resource_;
+}
+
 //********* PRIVATE METHODS **************//
 
+/**
+ * @brief allocates uninitialized storage
+ *
+ * @param buffer_capacity the number of entries the storage must be able to hold
+ * @param buffer_resource to allocate the storage from
+ */
+template <class ItemType, int InlineCapacity>
+ArrayBag<ItemType, InlineCapacity>::HeapBuffer::HeapBuffer(const int &buffer_capacity, std::pmr::memory_resource *buffer_resource) : elements{allocate(buffer_resource, buffer_capacity)},
+                                                                                                                                    capacity{buffer_capacity},
+                                                                                                                                    resource{buffer_resource},
+                                                                                                                                    count{0}
+{
+}
+
+/**
+ * @brief destroys the first count entries and releases the storage
+ */
+template <class ItemType, int InlineCapacity>
+ArrayBag<ItemType, InlineCapacity>::HeapBuffer::~HeapBuffer()
+{
+    if constexpr (!std::is_trivially_destructible<ItemType>::value)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            elements[i].~ItemType();
+        }
+    }
+    deallocate(resource, elements, capacity);
+}
+
 /**
  * @brief Get the index of target in elements_
  *
@@ -229,14 +757,115 @@ ItemType &ArrayBag<ItemType>::operator[](int i)
  * @return either the index target in elements_,
  * @return -1 if elements_ does not contain the target
  */
-template <class ItemType>
-int ArrayBag<ItemType>::getIndexOf(const ItemType &target) const
+template <class ItemType, int InlineCapacity>
+int ArrayBag<ItemType, InlineCapacity>::getIndexOf(const ItemType &target) const
+{
+    return getIndexIn(0, item_count_, target);
+}
+
+/**
+ * @brief Get the index of target in elements_, searching on several threads at once
+ *
+ * @param target to be found in elements_
+ * @param thread_count the most threads to use - 0 means one per hardware thread
+ * @note every thread stops as soon as a match is found before the blocks it has left to search
+ * @return either the lowest index of target in elements_,
+ * @return -1 if elements_ does not contain the target
+ */
+template <class ItemType, int InlineCapacity>
+int ArrayBag<ItemType, InlineCapacity>::getIndexOfParallel(const ItemType &target, const int &thread_count) const
+{
+    int worker_count = getWorkerCount(thread_count);
+    if (worker_count <= 1)
+    {
+        return getIndexOf(target);
+    }
+
+    // Holds the lowest match found so far, or item_count_ while there is none
+    int block_count = (item_count_ - 1) / PARALLEL_BLOCK_SIZE_ + 1;
+    std::atomic<int> lowest_index{item_count_};
+    TaskRunner::run(worker_count, [&](const size_t &worker)
+                    {
+        for (int block = static_cast<int>(worker); block < block_count; block += worker_count)
+        {
+            // Every block is searched in increasing order, so once a match lies before this one nothing further on can
+            // be the lowest - but every block before the final match is still searched by someone
+            int first = block * PARALLEL_BLOCK_SIZE_;
+            int current = lowest_index.load(std::memory_order_relaxed);
+            if (first >= current)
+            {
+                return;
+            }
+
+            int found_index = getIndexIn(first, std::min(first + PARALLEL_BLOCK_SIZE_, item_count_), target);
+            if (found_index > -1)
+            {
+                while (found_index < current && !lowest_index.compare_exchange_weak(current, found_index, std::memory_order_relaxed))
+                {
+                }
+                return;
+            }
+        } });
+
+    int result = lowest_index.load(std::memory_order_relaxed);
+    return result < item_count_ ? result : -1;
+}
+
+/**
+ * @brief counts the instances of an_entry in elements_[first, last)
+ *
+ * @param first index of the range
+ * @param last index past the end of the range
+ * @param an_entry whose intances are to be counted up
+ * @return the number of times an_entry is found in the range
+ */
+template <class ItemType, int InlineCapacity>
+int ArrayBag<ItemType, InlineCapacity>::getFrequencyIn(const int &first, const int &last, const ItemType &an_entry) const
 {
+    if constexpr (SimdSearch<ItemType>::IS_VECTORIZABLE_)
+    {
+        // Compare a whole vector register of entries at a time
+        return SimdSearch<ItemType>::frequencyOf(elements_ + first, last - first, an_entry);
+    }
+
+    int frequency = 0;
+    int curr_index = first;
+    while (curr_index < last)
+    {
+        if (elements_[curr_index] == an_entry)
+        {
+            frequency++;
+        }
+        curr_index++;
+    }
+
+    return frequency;
+}
+
+/**
+ * @brief Get the index of target in elements_[first, last)
+ *
+ * @param first index of the range
+ * @param last index past the end of the range
+ * @param target to be found in the range
+ * @return either the lowest index of target in the range,
+ * @return -1 if the range does not contain the target
+ */
+template <class ItemType, int InlineCapacity>
+int ArrayBag<ItemType, InlineCapacity>::getIndexIn(const int &first, const int &last, const ItemType &target) const
+{
+    if constexpr (SimdSearch<ItemType>::IS_VECTORIZABLE_)
+    {
+        // Compare a whole vector register of entries at a time
+        int result = SimdSearch<ItemType>::indexOf(elements_ + first, last - first, target);
+        return result > -1 ? first + result : -1;
+    }
+
     bool found = false;
     int result = -1;
-    int search_index = 0;
+    int search_index = first;
 
-    while (!found && (search_index < item_count_))
+    while (!found && (search_index < last))
     {
         if (elements_[search_index] == target)
         {
@@ -251,3 +880,305 @@ int ArrayBag<ItemType>::getIndexOf(const ItemType &target) const
 
     return result;
 }
+
+/**
+ * @brief gets the number of threads a parallel search over elements_ should use
+ *
+ * @param thread_count the most threads to use - 0 means one per hardware thread
+ * @return 1 if the bag is below PARALLEL_THRESHOLD_, otherwise thread_count capped at the number of blocks
+ */
+template <class ItemType, int InlineCapacity>
+int ArrayBag<ItemType, InlineCapacity>::getWorkerCount(const int &thread_count) const
+{
+    if (item_count_ < PARALLEL_THRESHOLD_)
+    {
+        return 1;
+    }
+    int worker_count = thread_count > 0 ? thread_count : static_cast<int>(std::thread::hardware_concurrency());
+    int block_count = (item_count_ - 1) / PARALLEL_BLOCK_SIZE_ + 1;
+    return std::max(1, std::min(worker_count, block_count));
+}
+
+/**
+ * @brief gets the capacity elements_ grows to once it is full
+ *
+ * @return twice the current capacity, or DEFAULT_ARRAY_SIZE_ if there is no capacity yet
+ */
+template <class ItemType, int InlineCapacity>
+int ArrayBag<ItemType, InlineCapacity>::getGrownCapacity() const
+{
+    return array_capacity_ > 0 ? array_capacity_ << 1 : DEFAULT_ARRAY_SIZE_;
+}
+
+/**
+ * @brief moves every entry into a new buffer holding new_capacity entries
+ *
+ * @pre new_capacity >= item_count_
+ * @param new_capacity of the new buffer - the inline buffer is used instead if new_capacity <= InlineCapacity
+ */
+template <class ItemType, int InlineCapacity>
+void ArrayBag<ItemType, InlineCapacity>::reallocate(const int &new_capacity)
+{
+    bool to_inline = InlineCapacity > 0 && new_capacity <= InlineCapacity;
+    if (to_inline)
+    {
+        if (!isInline())
+        {
+            transferStorage(nullptr, getInlineElements(), InlineCapacity);
+        }
+    }
+    else
+    {
+        std::shared_ptr<HeapBuffer> new_heap = makeHeapBuffer(new_capacity);
+        transferStorage(new_heap, new_heap->elements, new_capacity);
+    }
+}
+
+/**
+ * @brief gives this bag its own copy of the heap buffer if it is shared
+ *
+ * @post the bag can be modified without affecting any copy or snapshot
+ */
+template <class ItemType, int InlineCapacity>
+void ArrayBag<ItemType, InlineCapacity>::detach()
+{
+    if (isShared())
+    {
+        reallocate(array_capacity_);
+    }
+}
+
+/**
+ * @brief moves every entry into new_elements and lets go of the current storage
+ *
+ * @note the entries are copied instead of moved if the heap buffer is shared, since other bags still read them
+ * @param new_heap that owns new_elements, or nullptr if new_elements is the inline buffer
+ * @param new_elements uninitialized storage for at least item_count_ entries
+ * @param new_capacity of new_elements
+ */
+template <class ItemType, int InlineCapacity>
+void ArrayBag<ItemType, InlineCapacity>::transferStorage(const std::shared_ptr<HeapBuffer> &new_heap, ItemType *new_elements, const int &new_capacity)
+{
+    // Decide once - if another owner lets go in the meantime, its entries are still ours to destroy through heap_
+    bool shared = isShared();
+    if (shared)
+    {
+        std::uninitialized_copy(elements_, elements_ + item_count_, new_elements);
+    }
+    else
+    {
+        relocate(elements_, item_count_, new_elements);
+    }
+
+    if (heap_ != nullptr)
+    {
+        if (!shared)
+        {
+            // The entries were relocated, so there is nothing left for the old buffer to destroy
+            heap_->count = 0;
+        }
+        heap_.reset();
+    }
+
+    heap_ = new_heap;
+    elements_ = new_elements;
+    array_capacity_ = new_capacity;
+}
+
+/**
+ * @brief records item_count_ in the heap buffer, so that it destroys the right number of entries once released
+ *
+ * @note only writes when this bag is the sole owner - while the buffer is shared every owner holds the same count
+ */
+template <class ItemType, int InlineCapacity>
+void ArrayBag<ItemType, InlineCapacity>::publishCount() const
+{
+    if (heap_ != nullptr && !isShared())
+    {
+        heap_->count = item_count_;
+    }
+}
+
+/**
+ * @brief points elements_ at storage for at least capacity entries - the inline buffer if they fit, the heap otherwise
+ *
+ * @pre elements_ does not own any storage
+ * @param capacity the number of entries elements_ must be able to hold
+ */
+template <class ItemType, int InlineCapacity>
+void ArrayBag<ItemType, InlineCapacity>::initializeStorage(const int &capacity)
+{
+    if (InlineCapacity > 0 && capacity <= InlineCapacity)
+    {
+        elements_ = getInlineElements();
+        array_capacity_ = InlineCapacity;
+    }
+    else if (capacity > 0)
+    {
+        heap_ = makeHeapBuffer(capacity);
+        elements_ = heap_->elements;
+        array_capacity_ = capacity;
+    }
+    else
+    {
+        elements_ = nullptr;
+        array_capacity_ = 0;
+    }
+}
+
+/**
+ * @brief destroys every entry (or drops this bag's share of the heap buffer) and releases the storage
+ *
+ * @post the bag is empty and holds no storage
+ */
+template <class ItemType, int InlineCapacity>
+void ArrayBag<ItemType, InlineCapacity>::releaseStorage()
+{
+    if (heap_ != nullptr)
+    {
+        // The last owner to let go destroys the entries
+        publishCount();
+        heap_.reset();
+    }
+    else if constexpr (!std::is_trivially_destructible<ItemType>::value)
+    {
+        for (int i = 0; i < item_count_; i++)
+        {
+            elements_[i].~ItemType();
+        }
+    }
+
+    elements_ = nullptr;
+    array_capacity_ = 0;
+    item_count_ = 0;
+}
+
+/**
+ * @brief gets the inline buffer
+ *
+ * @return a pointer to the inline buffer, or nullptr if InlineCapacity is 0
+ */
+template <class ItemType, int InlineCapacity>
+ItemType *ArrayBag<ItemType, InlineCapacity>::getInlineElements()
+{
+    return InlineCapacity > 0 ? reinterpret_cast<ItemType *>(inline_elements_) : nullptr;
+}
+
+/**
+ * @brief moves the entries (or the heap buffer) of a_bag into this bag, which must not own any storage
+ *
+ * @param a_bag to be left empty
+ */
+template <class ItemType, int InlineCapacity>
+void ArrayBag<ItemType, InlineCapacity>::takeStorageOf(ArrayBag<ItemType, InlineCapacity> &a_bag) noexcept(IS_NOTHROW_MOVABLE_)
+{
+    if (a_bag.heap_ == nullptr)
+    {
+        // Inline entries cannot change hands, so move them one by one into this bag's inline buffer
+        initializeStorage(a_bag.array_capacity_);
+        relocate(a_bag.elements_, a_bag.item_count_, elements_);
+        item_count_ = a_bag.item_count_;
+    }
+    else
+    {
+        // Take over the heap buffer
+        heap_ = std::move(a_bag.heap_);
+        elements_ = a_bag.elements_;
+        array_capacity_ = a_bag.array_capacity_;
+        item_count_ = a_bag.item_count_;
+    }
+    a_bag.item_count_ = 0;
+    a_bag.initializeStorage(0);
+}
+
+/**
+ * @brief allocates a heap buffer (and its control block) from memory_resource_
+ *
+ * @param capacity the number of entries the buffer must be able to hold
+ * @return a pointer to the buffer
+ */
+template <class ItemType, int InlineCapacity>
+std::shared_ptr<typename ArrayBag<ItemType, InlineCapacity>::HeapBuffer> ArrayBag<ItemType, InlineCapacity>::makeHeapBuffer(const int &capacity) const
+{
+    return std::allocate_shared<HeapBuffer>(std::pmr::polymorphic_allocator<HeapBuffer>(memory_resource_), capacity, memory_resource_);
+}
+
+/**
+ * @brief allocates raw, uninitialized storage
+ *
+ * @param resource to allocate the storage from
+ * @param capacity the number of entries the storage must be able to hold
+ * @return a pointer to the storage, or nullptr if capacity is 0
+ */
+template <class ItemType, int InlineCapacity>
+ItemType *ArrayBag<ItemType, InlineCapacity>::allocate(std::pmr::memory_resource *resource, const int &capacity)
+{
+    if (capacity <= 0)
+    {
+        return nullptr;
+    }
+    return std::pmr::polymorphic_allocator<ItemType>(resource).allocate(capacity);
+}
+
+/**
+ * @brief releases storage returned by allocate() without destroying its entries
+ *
+ * @param resource that storage was allocated from
+ * @param storage to be released
+ * @param capacity that storage was allocated with
+ */
+template <class ItemType, int InlineCapacity>
+void ArrayBag<ItemType, InlineCapacity>::deallocate(std::pmr::memory_resource *resource, ItemType *storage, const int &capacity)
+{
+    if (storage != nullptr)
+    {
+        std::pmr::polymorphic_allocator<ItemType>(resource).deallocate(storage, capacity);
+    }
+}
+
+/**
+ * @brief moves count entries from source into the uninitialized storage at destination and destroys the originals
+ *
+ * @note trivially copyable entries are copied with a single memcpy, everything else is moved (or copied if its
+ * move constructor may throw, so that a failed relocation leaves source intact)
+ * @param source holding count constructed entries
+ * @param count the number of entries to relocate
+ * @param destination uninitialized storage for at least count entries
+ */
+template <class ItemType, int InlineCapacity>
+void ArrayBag<ItemType, InlineCapacity>::relocate(ItemType *source, const int &count, ItemType *destination)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+
+    if constexpr (std::is_trivially_copyable<ItemType>::value)
+    {
+        std::memcpy(static_cast<void *>(destination), static_cast<const void *>(source), sizeof(ItemType) * count);
+    }
+    else
+    {
+        int constructed = 0;
+        try
+        {
+            for (; constructed < count; constructed++)
+            {
+                ::new (static_cast<void *>(destination + constructed)) ItemType(std::move_if_noexcept(source[constructed]));
+            }
+        }
+        catch (...)
+        {
+            for (int i = 0; i < constructed; i++)
+            {
+                destination[i].~ItemType();
+            }
+            throw;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            source[i].~ItemType();
+        }
+    }
+}
\ No newline at end of file
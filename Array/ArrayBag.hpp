@@ -14,23 +14,97 @@
 
 #include <iostream>
 #include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <cstring>
+#include <type_traits>
+#include <atomic>
+#include <algorithm>
+#include <thread>
+#include "SimdSearch.hpp"
+#include "../Parallel/TaskRunner.hpp"
 
-template <class ItemType>
+/**
+ * @brief A bag of items stored contiguously in a growable array
+ *
+ * @tparam ItemType of the entries held by the bag
+ * @tparam InlineCapacity the number of entries stored inside the bag object itself - the array only moves to the heap
+ * once it holds more than InlineCapacity entries (0 means every entry lives on the heap)
+ * @note Copies share the heap buffer copy-on-write: copying is O(1), and a bag clones the buffer the first time it is
+ * modified while another bag still shares it
+ * @note Heap buffers are allocated from a std::pmr::memory_resource (the default resource unless one is given), so a
+ * short-lived bag can be backed by an arena such as std::pmr::monotonic_buffer_resource
+ */
+template <class ItemType, int InlineCapacity = 0>
 class ArrayBag
 {
+    static_assert(InlineCapacity >= 0, "InlineCapacity cannot be negative");
 
 public:
+    // The entries are contiguous, so plain pointers serve as iterators and the bag works with the standard algorithms
+    using value_type = ItemType;
+    using size_type = int;
+    using reference = ItemType &;
+    using const_reference = const ItemType &;
+    using iterator = ItemType *;
+    using const_iterator = const ItemType *;
+
     /**
      * @brief default Constructor
      */
     ArrayBag();
 
+    /**
+     * @brief parameterized constructor
+     *
+     * @param memory_resource to allocate every heap buffer from
+     */
+    explicit ArrayBag(std::pmr::memory_resource *memory_resource);
+
     /**
      * @brief parameterized constructor
      *
      * @param array_size whose value will determine the capacity of the array size at instantiation time
+     * @param memory_resource to allocate every heap buffer from
+     */
+    ArrayBag(const int &array_size, std::pmr::memory_resource *memory_resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief copy constructor
+     *
+     * @param a_bag whose heap buffer is shared copy-on-write (inline entries are copied right away)
+     * @note the copy allocates from the same memory resource as a_bag, since it may share a_bag's buffer
+     */
+    ArrayBag(const ArrayBag<ItemType, InlineCapacity> &a_bag);
+
+    /**
+     * @brief move constructor
+     *
+     * @param a_bag whose buffer is taken over (or whose inline entries are moved), leaving it empty
+     */
+    ArrayBag(ArrayBag<ItemType, InlineCapacity> &&a_bag) noexcept(IS_NOTHROW_MOVABLE_);
+
+    /**
+     * @brief destructor - destroys every entry and releases the buffer, unless a copy still shares it
+     */
+    ~ArrayBag();
+
+    /**
+     * @brief copy assignment operator
+     *
+     * @param a_bag whose heap buffer is shared copy-on-write (inline entries are copied right away)
+     * @return a reference to this bag
+     */
+    ArrayBag<ItemType, InlineCapacity> &operator=(const ArrayBag<ItemType, InlineCapacity> &a_bag);
+
+    /**
+     * @brief move assignment operator
+     *
+     * @param a_bag whose buffer is taken over (or whose inline entries are moved), leaving it empty
+     * @return a reference to this bag
      */
-    ArrayBag(const int &array_size);
+    ArrayBag<ItemType, InlineCapacity> &operator=(ArrayBag<ItemType, InlineCapacity> &&a_bag) noexcept(IS_NOTHROW_MOVABLE_);
 
     /**
      * @brief gets the current size of elements_
@@ -71,6 +145,27 @@ public:
      */
     bool contains(const ItemType &an_entry) const;
 
+    /**
+     * @brief gets the frequency of an object, counting on several threads at once
+     *
+     * @param an_entry whose intances in elements_ are to be counted up
+     * @param thread_count the most threads to use - 0 means one per hardware thread
+     * @note bags smaller than PARALLEL_THRESHOLD_ are counted on the calling thread alone
+     * @return the number of times an_entry is found
+     */
+    int getFrequencyOfParallel(const ItemType &an_entry, const int &thread_count = 0) const;
+
+    /**
+     * @brief locates an_entry, searching on several threads at once
+     *
+     * @param an_entry to be located in elements_
+     * @param thread_count the most threads to use - 0 means one per hardware thread
+     * @note bags smaller than PARALLEL_THRESHOLD_ are searched on the calling thread alone
+     * @return true if an_entry is found in elements_,
+     * @return false otherwise
+     */
+    bool containsParallel(const ItemType &an_entry, const int &thread_count = 0) const;
+
     /**
      * @brief adds new_entry into elements_
      *
@@ -80,6 +175,39 @@ public:
      */
     bool push_back(const ItemType &new_entry);
 
+    /**
+     * @brief moves new_entry into elements_
+     *
+     * @param new_entry to be moved to the back of elements_
+     * @return true if new_entry was successfully added to elements_,
+     * @return false otherwise
+     */
+    bool push_back(ItemType &&new_entry);
+
+    /**
+     * @brief constructs a new entry in place at the back of elements_
+     *
+     * @param args to be forwarded to the constructor of ItemType
+     * @return a reference to the new entry
+     */
+    template <class... Args>
+    ItemType &emplace_back(Args &&...args);
+
+    /**
+     * @brief makes sure elements_ can hold at least new_capacity entries without growing again
+     *
+     * @param new_capacity the minimum capacity of elements_
+     * @post the capacity is unchanged if it was already at least new_capacity
+     */
+    void reserve(const int &new_capacity);
+
+    /**
+     * @brief releases any capacity of elements_ beyond the current size of the bag
+     *
+     * @post the capacity of elements_ equals item_count_, or InlineCapacity if the entries fit in the inline buffer
+     */
+    void shrink_to_fit();
+
     /**
      * @brief removes the last entry in the array
      *
@@ -92,16 +220,35 @@ public:
      * @brief finds and removes an_entry from elements_
      *
      * @param an_entry to be removed
-     * @post moves the last entry of the array to the index of the removed item
+     * @post if the bag is unordered, the last entry of the array is moved to the index of the removed item in O(1),
+     * otherwise every later entry is shifted left by one
      * @return true if an_entry was successfully removed from elements_,
      * @return false otherwise
      */
     bool removeInstanceOf(const ItemType &an_entry);
 
+    /**
+     * @brief removes every instance of an_entry from elements_ in a single pass
+     *
+     * @param an_entry to be removed
+     * @return the number of entries removed
+     */
+    int removeAllInstancesOf(const ItemType &an_entry);
+
+    /**
+     * @brief removes every entry for which predicate returns true in a single pass
+     *
+     * @param predicate to be called once on each entry
+     * @post if the bag is ordered, the remaining entries keep their relative order
+     * @return the number of entries removed
+     */
+    template <class Predicate>
+    int remove_if(Predicate predicate);
+
     /**
      * @brief makes the array empty
      *
-     * @post does not actually empty the contents of elements_, but allows for them to be overwritten
+     * @post every entry is destroyed, but the capacity of elements_ is kept for reuse
      */
     void clear();
 
@@ -110,9 +257,9 @@ public:
      *
      * @param i is the index in the array
      * @note Bounds-checking is NOT performed -> Be sure to avoid using indexes greater than or equal to item_count_
-     * @return a copy of the item at the location specified by the parameter
+     * @return a read-only reference to the item at the location specified by the parameter
      */
-    ItemType operator[](int i) const;
+    const ItemType &operator[](int i) const;
 
     /**
      * @brief Allows direct element access using the [] operator
@@ -123,12 +270,165 @@ public:
      */
     ItemType &operator[](int i);
 
+    /**
+     * @brief gets an iterator to the first entry
+     *
+     * @note the entries may be written through the iterator, so a shared buffer is cloned first
+     * @return a pointer to the first entry of elements_
+     */
+    iterator begin();
+
+    /**
+     * @brief gets an iterator past the last entry
+     *
+     * @note the entries may be written through the iterator, so a shared buffer is cloned first
+     * @return a pointer past the last entry of elements_
+     */
+    iterator end();
+
+    /**
+     * @brief gets a read-only iterator to the first entry
+     *
+     * @return a pointer to the first entry of elements_
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief gets a read-only iterator past the last entry
+     *
+     * @return a pointer past the last entry of elements_
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief gets a read-only iterator to the first entry
+     *
+     * @return a pointer to the first entry of elements_
+     */
+    const_iterator cbegin() const;
+
+    /**
+     * @brief gets a read-only iterator past the last entry
+     *
+     * @return a pointer past the last entry of elements_
+     */
+    const_iterator cend() const;
+
+    /**
+     * @brief gets direct access to the underlying array
+     *
+     * @note the entries may be written through the pointer, so a shared buffer is cloned first
+     * @return a pointer to elements_, valid until the bag next grows or shrinks
+     */
+    ItemType *data();
+
+    /**
+     * @brief gets read-only access to the underlying array
+     *
+     * @return a pointer to elements_, valid until the bag next grows or shrinks
+     */
+    const ItemType *data() const;
+
+    /**
+     * @brief chooses whether removals keep the remaining entries in order
+     *
+     * @param ordered true to shift later entries left on removal, false to fill the hole with the last entry in O(1)
+     */
+    void setOrdered(const bool &ordered);
+
+    /**
+     * @brief checks if removals keep the remaining entries in order
+     *
+     * @return true if the bag is ordered (the default),
+     * @return false otherwise
+     */
+    bool isOrdered() const;
+
+    /**
+     * @brief takes a frozen view of the bag
+     *
+     * @note O(1) when the entries are on the heap - neither bag copies the buffer until one of them is modified
+     * @note must be called by the thread that modifies the bag (or while holding whatever lock guards it), after which
+     * the snapshot can be read by any thread without further locking
+     * @return a bag holding the current entries
+     */
+    ArrayBag<ItemType, InlineCapacity> snapshot() const;
+
+    /**
+     * @brief checks if the heap buffer is shared with a copy or snapshot of this bag
+     *
+     * @note a false result also acquires the buffer from the owners that let go of it, even on other threads - their
+     * reads of it happen before anything the caller then writes to it
+     * @return true if the next modification will clone the buffer,
+     * @return false otherwise
+     */
+    bool isShared() const;
+
+    /**
+     * @brief checks if the entries are stored inside the bag object rather than on the heap
+     *
+     * @return true if elements_ is the inline buffer,
+     * @return false otherwise
+     */
+    bool isInline() const;
+
+    /**
+     * @brief gets the memory resource the bag allocates its heap buffers from
+     *
+     * @return a pointer to the memory resource
+     */
+    std::pmr::memory_resource *getMemoryResource() const;
+
 protected:
-    static const int DEFAULT_ARRAY_SIZE_ = 1;
+    /**
+     * @brief heap storage that can be shared between bags, and that destroys its entries once the last bag lets go
+     */
+    struct HeapBuffer
+    {
+        /**
+         * @brief allocates uninitialized storage
+         *
+         * @param buffer_capacity the number of entries the storage must be able to hold
+         * @param buffer_resource to allocate the storage from
+         */
+        HeapBuffer(const int &buffer_capacity, std::pmr::memory_resource *buffer_resource);
+
+        /**
+         * @brief destroys the first count entries and releases the storage
+         */
+        ~HeapBuffer();
+
+        HeapBuffer(const HeapBuffer &) = delete;
+        HeapBuffer &operator=(const HeapBuffer &) = delete;
+
+        ItemType *elements;
+        int capacity;
+
+        // Kept with the storage, so that it is released to the right resource whichever bag lets go of it last
+        std::pmr::memory_resource *resource;
+
+        // Only kept up to date while the buffer is shared or released - the owning bag tracks item_count_ on its own
+        int count;
+    };
+
+    static constexpr int DEFAULT_ARRAY_SIZE_ = 1;
+
+    // Below this many entries a parallel search costs more in waking TaskRunner's workers than it saves
+    static constexpr int PARALLEL_THRESHOLD_ = 1 << 18;
+
+    // Parallel searches hand out the array in blocks of this many entries, and only check for cancellation between them
+    static constexpr int PARALLEL_BLOCK_SIZE_ = 1 << 15;
+
+    // Moving a bag only has to touch entries when they live in the inline buffer
+    static constexpr bool IS_NOTHROW_MOVABLE_ = InlineCapacity == 0 || std::is_nothrow_move_constructible<ItemType>::value;
 
     int array_capacity_;
     int item_count_;
-    std::shared_ptr<ItemType[]> elements_;
+    ItemType *elements_;
+    bool ordered_;
+    std::pmr::memory_resource *memory_resource_;
+    std::shared_ptr<HeapBuffer> heap_;
+    alignas(ItemType) unsigned char inline_elements_[InlineCapacity > 0 ? InlineCapacity * sizeof(ItemType) : 1];
 
     /**
      * @brief Get the index of target in elements_
@@ -138,6 +438,151 @@ protected:
      * @return -1 if elements_ does not contain the target
      */
     int getIndexOf(const ItemType &target) const;
+
+    /**
+     * @brief Get the index of target in elements_, searching on several threads at once
+     *
+     * @param target to be found in elements_
+     * @param thread_count the most threads to use - 0 means one per hardware thread
+     * @note every thread stops as soon as a match is found before the blocks it has left to search
+     * @return either the lowest index of target in elements_,
+     * @return -1 if elements_ does not contain the target
+     */
+    int getIndexOfParallel(const ItemType &target, const int &thread_count = 0) const;
+
+    /**
+     * @brief counts the instances of an_entry in elements_[first, last)
+     *
+     * @param first index of the range
+     * @param last index past the end of the range
+     * @param an_entry whose intances are to be counted up
+     * @return the number of times an_entry is found in the range
+     */
+    int getFrequencyIn(const int &first, const int &last, const ItemType &an_entry) const;
+
+    /**
+     * @brief Get the index of target in elements_[first, last)
+     *
+     * @param first index of the range
+     * @param last index past the end of the range
+     * @param target to be found in the range
+     * @return either the lowest index of target in the range,
+     * @return -1 if the range does not contain the target
+     */
+    int getIndexIn(const int &first, const int &last, const ItemType &target) const;
+
+    /**
+     * @brief gets the number of threads a parallel search over elements_ should use
+     *
+     * @param thread_count the most threads to use - 0 means one per hardware thread
+     * @return 1 if the bag is below PARALLEL_THRESHOLD_, otherwise thread_count capped at the number of blocks
+     */
+    int getWorkerCount(const int &thread_count) const;
+
+    /**
+     * @brief gets the capacity elements_ grows to once it is full
+     *
+     * @return twice the current capacity, or DEFAULT_ARRAY_SIZE_ if there is no capacity yet
+     */
+    int getGrownCapacity() const;
+
+    /**
+     * @brief moves every entry into a new buffer holding new_capacity entries
+     *
+     * @pre new_capacity >= item_count_
+     * @param new_capacity of the new buffer - the inline buffer is used instead if new_capacity <= InlineCapacity
+     */
+    void reallocate(const int &new_capacity);
+
+    /**
+     * @brief gives this bag its own copy of the heap buffer if it is shared
+     *
+     * @post the bag can be modified without affecting any copy or snapshot
+     */
+    void detach();
+
+    /**
+     * @brief moves every entry into new_elements and lets go of the current storage
+     *
+     * @note the entries are copied instead of moved if the heap buffer is shared, since other bags still read them
+     * @param new_heap that owns new_elements, or nullptr if new_elements is the inline buffer
+     * @param new_elements uninitialized storage for at least item_count_ entries
+     * @param new_capacity of new_elements
+     */
+    void transferStorage(const std::shared_ptr<HeapBuffer> &new_heap, ItemType *new_elements, const int &new_capacity);
+
+    /**
+     * @brief records item_count_ in the heap buffer, so that it destroys the right number of entries once released
+     *
+     * @note only writes when this bag is the sole owner - while the buffer is shared every owner holds the same count
+     */
+    void publishCount() const;
+
+    /**
+     * @brief points elements_ at storage for at least capacity entries - the inline buffer if they fit, the heap otherwise
+     *
+     * @pre elements_ does not own any storage
+     * @param capacity the number of entries elements_ must be able to hold
+     */
+    void initializeStorage(const int &capacity);
+
+    /**
+     * @brief destroys every entry (or drops this bag's share of the heap buffer) and releases the storage
+     *
+     * @post the bag is empty and holds no storage
+     */
+    void releaseStorage();
+
+    /**
+     * @brief gets the inline buffer
+     *
+     * @return a pointer to the inline buffer, or nullptr if InlineCapacity is 0
+     */
+    ItemType *getInlineElements();
+
+    /**
+     * @brief moves the entries (or the heap buffer) of a_bag into this bag, which must not own any storage
+     *
+     * @param a_bag to be left empty
+     */
+    void takeStorageOf(ArrayBag<ItemType, InlineCapacity> &a_bag) noexcept(IS_NOTHROW_MOVABLE_);
+
+    /**
+     * @brief allocates a heap buffer (and its control block) from memory_resource_
+     *
+     * @param capacity the number of entries the buffer must be able to hold
+     * @return a pointer to the buffer
+     */
+    std::shared_ptr<HeapBuffer> makeHeapBuffer(const int &capacity) const;
+
+    /**
+     * @brief allocates raw, uninitialized storage
+     *
+     * @param resource to allocate the storage from
+     * @param capacity the number of entries the storage must be able to hold
+     * @return a pointer to the storage, or nullptr if capacity is 0
+     */
+    static ItemType *allocate(std::pmr::memory_resource *resource, const int &capacity);
+
+    /**
+     * @brief releases storage returned by allocate() without destroying its entries
+     *
+     * @param resource that storage was allocated from
+     * @param storage to be released
+     * @param capacity that storage was allocated with
+     */
+    static void deallocate(std::pmr::memory_resource *resource, ItemType *storage, const int &capacity);
+
+    /**
+     * @brief moves count entries from source into the uninitialized storage at destination and destroys the originals
+     *
+     * @note trivially copyable entries are copied with a single memcpy, everything else is moved (or copied if its
+     * move constructor may throw, so that a failed relocation leaves source intact)
+     * @param source holding count constructed entries
+     * @param count the number of entries to relocate
+     * @param destination uninitialized storage for at least count entries
+     */
+    static void relocate(ItemType *source, const int &count, ItemType *destination);
 };
 
 #include "ArrayBag.cpp"
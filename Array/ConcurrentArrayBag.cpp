@@ -0,0 +1,501 @@
+/**
+ * @file ConcurrentArrayBag.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Implementation for ConcurrentArrayBag class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "ConcurrentArrayBag.hpp"
+
+/**
+ * @brief default constructor
+ */
+template <class ItemType>
+ConcurrentArrayBag<ItemType>::ConcurrentArrayBag() : reserved_{0}, published_{0}
+{
+    for (std::atomic<Segment *> &segment : segments_)
+    {
+        segment.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param array_size the number of entries to allocate room for up front
+ */
+template <class ItemType>
+ConcurrentArrayBag<ItemType>::ConcurrentArrayBag(const int &array_size) : ConcurrentArrayBag()
+{
+    reserve(array_size);
+}
+
+/**
+ * @brief destructor - destroys every entry and releases every segment
+ *
+ * @pre no other thread is using the bag
+ */
+template <class ItemType>
+ConcurrentArrayBag<ItemType>::~ConcurrentArrayBag()
+{
+    clear();
+    for (std::atomic<Segment *> &segment : segments_)
+    {
+        delete segment.load(std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief gets the number of published entries
+ *
+ * @return the current size of the bag
+ */
+template <class ItemType>
+int ConcurrentArrayBag<ItemType>::getCurrentSize() const
+{
+    // Producers only mark their own slot ready - readers advance published_ past whatever has become ready since
+    int published = published_.load(std::memory_order_acquire);
+    int advanced = published;
+    while (advanced < MAX_CAPACITY_)
+    {
+        int segment_number = getSegmentOf(advanced);
+        Segment *segment = segments_[segment_number].load(std::memory_order_acquire);
+        if (segment == nullptr || segment == getFailedMarker())
+        {
+            break;
+        }
+        int offset = advanced - getSegmentStart(segment_number);
+        while (offset < segment->size && segment->ready[offset].load(std::memory_order_acquire))
+        {
+            offset++;
+        }
+        advanced = getSegmentStart(segment_number) + offset;
+        if (offset < segment->size)
+        {
+            break;
+        }
+    }
+
+    // Other readers may be advancing it too - it only ever moves forward
+    while (published < advanced && !published_.compare_exchange_weak(published, advanced, std::memory_order_release, std::memory_order_acquire))
+    {
+    }
+    return advanced;
+}
+
+/**
+ * @brief gets the number of entries the allocated segments can hold
+ *
+ * @return the current capacity of the bag
+ */
+template <class ItemType>
+int ConcurrentArrayBag<ItemType>::getCurrentCapacity() const
+{
+    int capacity = 0;
+    for (const std::atomic<Segment *> &segment : segments_)
+    {
+        Segment *allocated = segment.load(std::memory_order_acquire);
+        if (allocated != nullptr && allocated != getFailedMarker())
+        {
+            capacity += allocated->size;
+        }
+    }
+    return capacity;
+}
+
+/**
+ * @brief gets the frequency of an object among the published entries
+ *
+ * @param an_entry whose intances are to be counted up
+ * @return the number of times an_entry is found
+ */
+template <class ItemType>
+int ConcurrentArrayBag<ItemType>::getFrequencyOf(const ItemType &an_entry) const
+{
+    int frequency = 0;
+    forEachRun([&](const ItemType *elements, const int &count)
+               {
+        frequency += SimdSearch<ItemType>::frequencyOf(elements, count, an_entry);
+        return true; });
+    return frequency;
+}
+
+/**
+ * @brief checks if no entry has been published
+ *
+ * @return true if the published size is 0,
+ * @return false otherwise
+ */
+template <class ItemType>
+bool ConcurrentArrayBag<ItemType>::isEmpty() const
+{
+    return getCurrentSize() == 0;
+}
+
+/**
+ * @brief locates an_entry among the published entries
+ *
+ * @param an_entry to be located
+ * @return true if an_entry is found,
+ * @return false otherwise
+ */
+template <class ItemType>
+bool ConcurrentArrayBag<ItemType>::contains(const ItemType &an_entry) const
+{
+    bool found = false;
+    forEachRun([&](const ItemType *elements, const int &count)
+               {
+        found = SimdSearch<ItemType>::indexOf(elements, count, an_entry) > -1;
+        return !found; });
+    return found;
+}
+
+/**
+ * @brief adds new_entry into the bag - safe to call from any number of threads at once
+ *
+ * @param new_entry to insert
+ * @return true if new_entry was added,
+ * @return false if the bag is at MAX_CAPACITY_
+ */
+template <class ItemType>
+bool ConcurrentArrayBag<ItemType>::push_back(const ItemType &new_entry)
+{
+    return emplace_back(new_entry) > -1;
+}
+
+/**
+ * @brief moves new_entry into the bag - safe to call from any number of threads at once
+ *
+ * @param new_entry to be moved into the bag
+ * @return true if new_entry was added,
+ * @return false if the bag is at MAX_CAPACITY_
+ */
+template <class ItemType>
+bool ConcurrentArrayBag<ItemType>::push_back(ItemType &&new_entry)
+{
+    return append(std::move(new_entry)) > -1;
+}
+
+/**
+ * @brief constructs a new entry and adds it into the bag - safe to call from any number of threads at once
+ *
+ * @param args to be forwarded to the constructor of ItemType
+ * @note the entry is built before a slot is claimed, so a throwing constructor leaves the bag untouched
+ * @return the index of the new entry, which is published once every entry before it is,
+ * @return -1 if the bag is at MAX_CAPACITY_
+ */
+template <class ItemType>
+template <class... Args>
+int ConcurrentArrayBag<ItemType>::emplace_back(Args &&...args)
+{
+    return append(ItemType(std::forward<Args>(args)...));
+}
+
+/**
+ * @brief allocates every segment needed to hold new_capacity entries - safe to call while producers append
+ *
+ * @param new_capacity the minimum capacity of the bag
+ * @note reserving up front keeps allocation off the append path
+ */
+template <class ItemType>
+void ConcurrentArrayBag<ItemType>::reserve(const int &new_capacity)
+{
+    if (new_capacity <= 0)
+    {
+        return;
+    }
+    int last_segment = getSegmentOf(new_capacity < MAX_CAPACITY_ ? new_capacity - 1 : MAX_CAPACITY_ - 1);
+    for (int segment = 0; segment <= last_segment; segment++)
+    {
+        getSegment(segment);
+    }
+}
+
+/**
+ * @brief destroys every entry and keeps the segments for reuse
+ *
+ * @pre no other thread is using the bag
+ */
+template <class ItemType>
+void ConcurrentArrayBag<ItemType>::clear()
+{
+    // Claims made once the bag was full leave reserved_ past MAX_CAPACITY_
+    int reserved = reserved_.load(std::memory_order_relaxed);
+    reserved = reserved < MAX_CAPACITY_ ? reserved : MAX_CAPACITY_;
+    for (int segment_number = 0; segment_number < SEGMENT_COUNT_; segment_number++)
+    {
+        Segment *segment = segments_[segment_number].load(std::memory_order_relaxed);
+        if (segment == getFailedMarker())
+        {
+            // Give the allocation another chance
+            segments_[segment_number].store(nullptr, std::memory_order_relaxed);
+            continue;
+        }
+        int start = getSegmentStart(segment_number);
+        if (segment == nullptr || start >= reserved)
+        {
+            continue;
+        }
+
+        // A slot whose claimant failed to get its segment was never filled
+        int count = reserved - start < segment->size ? reserved - start : segment->size;
+        for (int offset = 0; offset < count; offset++)
+        {
+            if (segment->ready[offset].load(std::memory_order_relaxed))
+            {
+                segment->elements[offset].~ItemType();
+                segment->ready[offset].store(false, std::memory_order_relaxed);
+            }
+        }
+    }
+    reserved_.store(0, std::memory_order_relaxed);
+    published_.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Allows direct element access using the [] operator
+ *
+ * @param i is the index in the bag
+ * @note Bounds-checking is NOT performed -> Be sure to avoid using indexes greater than or equal to the published size
+ * @return a read-only reference to the item at the location specified by the parameter, which never moves
+ */
+template <class ItemType>
+const ItemType &ConcurrentArrayBag<ItemType>::operator[](int i) const
+{
+    int segment = getSegmentOf(i);
+    return segments_[segment].load(std::memory_order_acquire)->elements[i - getSegmentStart(segment)];
+}
+
+//********* PRIVATE METHODS **************//
+
+/**
+ * @brief allocates uninitialized storage for segment_size entries, none of them ready
+ *
+ * @param segment_size the number of entries in the segment
+ */
+template <class ItemType>
+ConcurrentArrayBag<ItemType>::Segment::Segment(const int &segment_size) : elements{std::allocator<ItemType>().allocate(segment_size)},
+                                                                          size{segment_size}
+{
+    try
+    {
+        ready.reset(new std::atomic<bool>[segment_size]());
+    }
+    catch (...)
+    {
+        std::allocator<ItemType>().deallocate(elements, size);
+        throw;
+    }
+}
+
+/**
+ * @brief releases the storage without destroying any entry
+ */
+template <class ItemType>
+ConcurrentArrayBag<ItemType>::Segment::~Segment()
+{
+    std::allocator<ItemType>().deallocate(elements, size);
+}
+
+/**
+ * @brief gets the segment holding index
+ *
+ * @param index in the bag
+ * @return the number of the segment
+ */
+template <class ItemType>
+int ConcurrentArrayBag<ItemType>::getSegmentOf(const int &index)
+{
+    // Segment k starts at FIRST_SEGMENT_SIZE_ * (2^k - 1), so k is the highest set bit of index / FIRST_SEGMENT_SIZE_ + 1
+    unsigned int bucket = static_cast<unsigned int>(index) / FIRST_SEGMENT_SIZE_ + 1;
+#if defined(__GNUC__) || defined(__clang__)
+    return 31 - __builtin_clz(bucket);
+#else
+    int segment = 0;
+    while (bucket >>= 1)
+    {
+        segment++;
+    }
+    return segment;
+#endif
+}
+
+/**
+ * @brief gets the index of the first entry of a segment
+ *
+ * @param segment number
+ * @return the index in the bag of the segment's first entry
+ */
+template <class ItemType>
+int ConcurrentArrayBag<ItemType>::getSegmentStart(const int &segment)
+{
+    return FIRST_SEGMENT_SIZE_ * ((1 << segment) - 1);
+}
+
+/**
+ * @brief gets a segment, allocating it if no thread has yet
+ *
+ * @param segment number
+ * @throw std::bad_alloc if the segment cannot be allocated, or a producer already failed to allocate it
+ * @return the segment
+ */
+template <class ItemType>
+typename ConcurrentArrayBag<ItemType>::Segment *ConcurrentArrayBag<ItemType>::getSegment(const int &segment)
+{
+    Segment *current = segments_[segment].load(std::memory_order_acquire);
+    if (current == getFailedMarker())
+    {
+        throw std::bad_alloc();
+    }
+    if (current != nullptr)
+    {
+        return current;
+    }
+
+    // Several threads may race to allocate the same segment - the first to install theirs wins, the rest throw theirs away
+    Segment *allocated = new Segment(FIRST_SEGMENT_SIZE_ << segment);
+    if (segments_[segment].compare_exchange_strong(current, allocated, std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+        return allocated;
+    }
+    delete allocated;
+    if (current == getFailedMarker())
+    {
+        throw std::bad_alloc();
+    }
+    return current;
+}
+
+/**
+ * @brief gets the segment of a claimed slot - the claimant of the segment's first slot allocates it, and every other
+ * claimant waits until it has
+ *
+ * @param segment_number of the claimed slot
+ * @param index of the claimed slot
+ * @throw std::bad_alloc if the segment, or any segment before it, could not be allocated
+ * @return the segment
+ */
+template <class ItemType>
+typename ConcurrentArrayBag<ItemType>::Segment *ConcurrentArrayBag<ItemType>::getClaimedSegment(const int &segment_number, const int &index)
+{
+    Segment *segment = segments_[segment_number].load(std::memory_order_acquire);
+    if (segment == nullptr && index == getSegmentStart(segment_number))
+    {
+        // Segments are settled in order, so once one cannot be allocated every later one fails too - and no entry is
+        // ever filled in past a slot that never will be
+        Segment *allocated = getFailedMarker();
+        if (segment_number == 0 || waitForSegment(segment_number - 1) != getFailedMarker())
+        {
+            try
+            {
+                allocated = new Segment(FIRST_SEGMENT_SIZE_ << segment_number);
+            }
+            catch (const std::bad_alloc &)
+            {
+            }
+        }
+
+        // reserve() may have installed the segment in the meantime
+        if (!segments_[segment_number].compare_exchange_strong(segment, allocated, std::memory_order_acq_rel, std::memory_order_acquire) &&
+            allocated != getFailedMarker())
+        {
+            delete allocated;
+        }
+    }
+
+    segment = waitForSegment(segment_number);
+    if (segment == getFailedMarker())
+    {
+        throw std::bad_alloc();
+    }
+    return segment;
+}
+
+/**
+ * @brief waits until a segment has been settled
+ *
+ * @param segment_number to wait for
+ * @return the segment, or getFailedMarker() if it could not be allocated
+ */
+template <class ItemType>
+typename ConcurrentArrayBag<ItemType>::Segment *ConcurrentArrayBag<ItemType>::waitForSegment(const int &segment_number) const
+{
+    Segment *segment = segments_[segment_number].load(std::memory_order_acquire);
+    while (segment == nullptr)
+    {
+        std::this_thread::yield();
+        segment = segments_[segment_number].load(std::memory_order_acquire);
+    }
+    return segment;
+}
+
+/**
+ * @brief gets the value a segment pointer holds once its segment could not be allocated - never a real segment
+ *
+ * @return a pointer to the bag itself, as a Segment pointer that is never dereferenced
+ */
+template <class ItemType>
+typename ConcurrentArrayBag<ItemType>::Segment *ConcurrentArrayBag<ItemType>::getFailedMarker() const noexcept
+{
+    return reinterpret_cast<Segment *>(const_cast<ConcurrentArrayBag<ItemType> *>(this));
+}
+
+/**
+ * @brief moves new_entry into a freshly claimed slot and marks it ready
+ *
+ * @param new_entry to be moved into the bag
+ * @throw std::bad_alloc if the slot's segment cannot be allocated - the bag then stops growing at that segment until
+ * clear()
+ * @return the index of the new entry, or -1 if the bag is at MAX_CAPACITY_
+ */
+template <class ItemType>
+int ConcurrentArrayBag<ItemType>::append(ItemType &&new_entry)
+{
+    // Checked before claiming too, so that reserved_ overshoots MAX_CAPACITY_ by at most one claim per producer
+    if (reserved_.load(std::memory_order_relaxed) >= MAX_CAPACITY_)
+    {
+        return -1;
+    }
+    int index = reserved_.fetch_add(1, std::memory_order_relaxed);
+    if (index >= MAX_CAPACITY_)
+    {
+        return -1;
+    }
+
+    int segment_number = getSegmentOf(index);
+    Segment *segment = getClaimedSegment(segment_number, index);
+    int offset = index - getSegmentStart(segment_number);
+    ::new (static_cast<void *>(segment->elements + offset)) ItemType(std::move(new_entry));
+    segment->ready[offset].store(true, std::memory_order_release);
+    return index;
+}
+
+/**
+ * @brief calls visit(elements, count) on each contiguous run of published entries, in order
+ *
+ * @param visit to be called with a pointer to a run and its length - returns false to stop early
+ */
+template <class ItemType>
+template <class Visitor>
+void ConcurrentArrayBag<ItemType>::forEachRun(Visitor visit) const
+{
+    int published = getCurrentSize();
+    for (int segment_number = 0; segment_number < SEGMENT_COUNT_; segment_number++)
+    {
+        int start = getSegmentStart(segment_number);
+        if (start >= published)
+        {
+            return;
+        }
+        Segment *segment = segments_[segment_number].load(std::memory_order_acquire);
+        int count = published - start < segment->size ? published - start : segment->size;
+        if (!visit(static_cast<const ItemType *>(segment->elements), count))
+        {
+            return;
+        }
+    }
+}
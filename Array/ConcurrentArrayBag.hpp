@@ -0,0 +1,268 @@
+/**
+ * @file ConcurrentArrayBag.hpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Interface for ConcurrentArrayBag class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef CONCURRENT_ARRAY_BAG_
+#define CONCURRENT_ARRAY_BAG_
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "SimdSearch.hpp"
+
+/**
+ * @brief A bag that any number of threads can append to at once without a lock, while other threads read it
+ *
+ * @note Producers claim slots with a single atomic fetch-and-add. The array is split into segments that double in size
+ * and are never moved once allocated, so growing never stops a reader or invalidates a reference. The producer that
+ * claims a segment's first slot allocates it, and the others claiming slots in it wait until it has
+ * @note Readers only see the published prefix - the longest run of entries, starting at index 0, whose construction has
+ * finished. Producers just mark their own slot ready, and readers move the prefix forward as they find it has grown.
+ * getCurrentSize(), getFrequencyOf(), contains() and operator[] are safe to call while producers append
+ * @note If a segment cannot be allocated, the producers that claimed slots in it throw std::bad_alloc, and the bag
+ * stops growing at that segment until clear()
+ * @note ItemType must be nothrow move constructible, so that a claimed slot is always filled
+ */
+template <class ItemType>
+class ConcurrentArrayBag
+{
+    static_assert(std::is_nothrow_move_constructible<ItemType>::value, "ConcurrentArrayBag needs a nothrow move constructor");
+
+public:
+    /**
+     * @brief default constructor
+     */
+    ConcurrentArrayBag();
+
+    /**
+     * @brief parameterized constructor
+     *
+     * @param array_size the number of entries to allocate room for up front
+     */
+    ConcurrentArrayBag(const int &array_size);
+
+    ConcurrentArrayBag(const ConcurrentArrayBag<ItemType> &a_bag) = delete;
+    ConcurrentArrayBag<ItemType> &operator=(const ConcurrentArrayBag<ItemType> &a_bag) = delete;
+
+    /**
+     * @brief destructor - destroys every entry and releases every segment
+     *
+     * @pre no other thread is using the bag
+     */
+    ~ConcurrentArrayBag();
+
+    /**
+     * @brief gets the number of published entries
+     *
+     * @return the current size of the bag
+     */
+    int getCurrentSize() const;
+
+    /**
+     * @brief gets the number of entries the allocated segments can hold
+     *
+     * @return the current capacity of the bag
+     */
+    int getCurrentCapacity() const;
+
+    /**
+     * @brief gets the frequency of an object among the published entries
+     *
+     * @param an_entry whose intances are to be counted up
+     * @return the number of times an_entry is found
+     */
+    int getFrequencyOf(const ItemType &an_entry) const;
+
+    /**
+     * @brief checks if no entry has been published
+     *
+     * @return true if the published size is 0,
+     * @return false otherwise
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief locates an_entry among the published entries
+     *
+     * @param an_entry to be located
+     * @return true if an_entry is found,
+     * @return false otherwise
+     */
+    bool contains(const ItemType &an_entry) const;
+
+    /**
+     * @brief adds new_entry into the bag - safe to call from any number of threads at once
+     *
+     * @param new_entry to insert
+     * @return true if new_entry was added,
+     * @return false if the bag is at MAX_CAPACITY_
+     */
+    bool push_back(const ItemType &new_entry);
+
+    /**
+     * @brief moves new_entry into the bag - safe to call from any number of threads at once
+     *
+     * @param new_entry to be moved into the bag
+     * @return true if new_entry was added,
+     * @return false if the bag is at MAX_CAPACITY_
+     */
+    bool push_back(ItemType &&new_entry);
+
+    /**
+     * @brief constructs a new entry and adds it into the bag - safe to call from any number of threads at once
+     *
+     * @param args to be forwarded to the constructor of ItemType
+     * @note the entry is built before a slot is claimed, so a throwing constructor leaves the bag untouched
+     * @return the index of the new entry, which is published once every entry before it is,
+     * @return -1 if the bag is at MAX_CAPACITY_
+     */
+    template <class... Args>
+    int emplace_back(Args &&...args);
+
+    /**
+     * @brief allocates every segment needed to hold new_capacity entries - safe to call while producers append
+     *
+     * @param new_capacity the minimum capacity of the bag
+     * @note reserving up front keeps allocation off the append path
+     */
+    void reserve(const int &new_capacity);
+
+    /**
+     * @brief destroys every entry and keeps the segments for reuse
+     *
+     * @pre no other thread is using the bag
+     */
+    void clear();
+
+    /**
+     * @brief Allows direct element access using the [] operator
+     *
+     * @param i is the index in the bag
+     * @note Bounds-checking is NOT performed -> Be sure to avoid using indexes greater than or equal to the published size
+     * @return a read-only reference to the item at the location specified by the parameter, which never moves
+     */
+    const ItemType &operator[](int i) const;
+
+    // Segment k holds FIRST_SEGMENT_SIZE_ << k entries, which caps the bag at MAX_CAPACITY_ entries - a long way below
+    // INT_MAX, so that claims made once the bag is full cannot overflow reserved_
+    static constexpr int SEGMENT_COUNT_ = 24;
+    static constexpr int FIRST_SEGMENT_SIZE_ = 64;
+    static constexpr int MAX_CAPACITY_ = FIRST_SEGMENT_SIZE_ * ((1 << SEGMENT_COUNT_) - 1);
+
+private:
+    /**
+     * @brief a block of slots that is never moved once allocated
+     */
+    struct Segment
+    {
+        /**
+         * @brief allocates uninitialized storage for segment_size entries, none of them ready
+         *
+         * @param segment_size the number of entries in the segment
+         */
+        Segment(const int &segment_size);
+
+        /**
+         * @brief releases the storage without destroying any entry
+         */
+        ~Segment();
+
+        Segment(const Segment &) = delete;
+        Segment &operator=(const Segment &) = delete;
+
+        ItemType *elements;
+        int size;
+
+        // ready[i] is set once elements[i] has been constructed
+        std::unique_ptr<std::atomic<bool>[]> ready;
+    };
+
+    std::atomic<Segment *> segments_[SEGMENT_COUNT_];
+
+    // Kept on separate cache lines - every producer writes reserved_, and only readers write published_. Every slot
+    // below reserved_, up to MAX_CAPACITY_, is filled by the producer that claimed it unless its segment failed
+    alignas(64) std::atomic<int> reserved_;
+    alignas(64) mutable std::atomic<int> published_;
+
+    /**
+     * @brief gets the segment holding index
+     *
+     * @param index in the bag
+     * @return the number of the segment
+     */
+    static int getSegmentOf(const int &index);
+
+    /**
+     * @brief gets the index of the first entry of a segment
+     *
+     * @param segment number
+     * @return the index in the bag of the segment's first entry
+     */
+    static int getSegmentStart(const int &segment);
+
+    /**
+     * @brief gets a segment, allocating it if no thread has yet
+     *
+     * @param segment number
+     * @throw std::bad_alloc if the segment cannot be allocated, or a producer already failed to allocate it
+     * @return the segment
+     */
+    Segment *getSegment(const int &segment);
+
+    /**
+     * @brief gets the segment of a claimed slot - the claimant of the segment's first slot allocates it, and every
+     * other claimant waits until it has
+     *
+     * @param segment_number of the claimed slot
+     * @param index of the claimed slot
+     * @throw std::bad_alloc if the segment, or any segment before it, could not be allocated
+     * @return the segment
+     */
+    Segment *getClaimedSegment(const int &segment_number, const int &index);
+
+    /**
+     * @brief waits until a segment has been settled
+     *
+     * @param segment_number to wait for
+     * @return the segment, or getFailedMarker() if it could not be allocated
+     */
+    Segment *waitForSegment(const int &segment_number) const;
+
+    /**
+     * @brief gets the value a segment pointer holds once its segment could not be allocated - never a real segment
+     *
+     * @return a pointer to the bag itself, as a Segment pointer that is never dereferenced
+     */
+    Segment *getFailedMarker() const noexcept;
+
+    /**
+     * @brief moves new_entry into a freshly claimed slot and marks it ready
+     *
+     * @param new_entry to be moved into the bag
+     * @throw std::bad_alloc if the slot's segment cannot be allocated - the bag then stops growing at that segment
+     * until clear()
+     * @return the index of the new entry, or -1 if the bag is at MAX_CAPACITY_
+     */
+    int append(ItemType &&new_entry);
+
+    /**
+     * @brief calls visit(elements, count) on each contiguous run of published entries, in order
+     *
+     * @param visit to be called with a pointer to a run and its length - returns false to stop early
+     */
+    template <class Visitor>
+    void forEachRun(Visitor visit) const;
+};
+
+#include "ConcurrentArrayBag.cpp"
+#endif
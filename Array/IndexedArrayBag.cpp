@@ -0,0 +1,395 @@
+/**
+ * @file IndexedArrayBag.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Implementation for IndexedArrayBag class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "IndexedArrayBag.hpp"
+
+/**
+ * @brief default constructor
+ */
+template <class ItemType, int InlineCapacity>
+IndexedArrayBag<ItemType, InlineCapacity>::IndexedArrayBag() : ArrayBag<ItemType, InlineCapacity>()
+{
+}
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param array_size whose value will determine the capacity of the array size at instantiation time
+ * @param memory_resource to allocate every heap buffer from
+ */
+template <class ItemType, int InlineCapacity>
+IndexedArrayBag<ItemType, InlineCapacity>::IndexedArrayBag(const int &array_size, std::pmr::memory_resource *memory_resource) : ArrayBag<ItemType, InlineCapacity>(array_size, memory_resource)
+{
+    slots_.reserve(this->array_capacity_);
+}
+
+/**
+ * @brief gets the frequency of an object in O(1)
+ *
+ * @param an_entry whose intances in elements_ are to be counted up
+ * @return the number of times an_entry is found
+ */
+template <class ItemType, int InlineCapacity>
+int IndexedArrayBag<ItemType, InlineCapacity>::getFrequencyOf(const ItemType &an_entry) const
+{
+    auto found = positions_.find(an_entry);
+    return found == positions_.end() ? 0 : static_cast<int>(found->second.size());
+}
+
+/**
+ * @brief locates an_entry in O(1)
+ *
+ * @param an_entry to be located in elements_
+ * @return true if an_entry is found in elements_,
+ * @return false otherwise
+ */
+template <class ItemType, int InlineCapacity>
+bool IndexedArrayBag<ItemType, InlineCapacity>::contains(const ItemType &an_entry) const
+{
+    return getFrequencyOf(an_entry) > 0;
+}
+
+/**
+ * @brief adds new_entry at the end of elements_
+ *
+ * @param new_entry to insert into elements_
+ * @return true as long as there is available RAM on the system since the array's size can increase
+ */
+template <class ItemType, int InlineCapacity>
+bool IndexedArrayBag<ItemType, InlineCapacity>::push_back(const ItemType &new_entry)
+{
+    emplace_back(new_entry);
+    return true;
+}
+
+/**
+ * @brief moves new_entry to the end of elements_
+ *
+ * @param new_entry to be moved to the back of elements_
+ * @return true as long as there is available RAM on the system since the array's size can increase
+ */
+template <class ItemType, int InlineCapacity>
+bool IndexedArrayBag<ItemType, InlineCapacity>::push_back(ItemType &&new_entry)
+{
+    emplace_back(std::move(new_entry));
+    return true;
+}
+
+/**
+ * @brief constructs a new entry in place at the back of elements_
+ *
+ * @param args to be forwarded to the constructor of ItemType
+ * @return a read-only reference to the new entry
+ */
+template <class ItemType, int InlineCapacity>
+template <class... Args>
+const ItemType &IndexedArrayBag<ItemType, InlineCapacity>::emplace_back(Args &&...args)
+{
+    ArrayBag<ItemType, InlineCapacity>::emplace_back(std::forward<Args>(args)...);
+    try
+    {
+        indexEntry(this->item_count_ - 1);
+    }
+    catch (...)
+    {
+        // Keep the array and the index in step
+        ArrayBag<ItemType, InlineCapacity>::pop_back();
+        throw;
+    }
+    return this->elements_[this->item_count_ - 1];
+}
+
+/**
+ * @brief removes the last entry in the array
+ *
+ * @return true if the last entry in the array was removed,
+ * @return false otherwise
+ */
+template <class ItemType, int InlineCapacity>
+bool IndexedArrayBag<ItemType, InlineCapacity>::pop_back()
+{
+    if (this->isEmpty())
+    {
+        return false;
+    }
+    unindexEntry(this->item_count_ - 1);
+    slots_.pop_back();
+    return ArrayBag<ItemType, InlineCapacity>::pop_back();
+}
+
+/**
+ * @brief finds and removes an_entry from elements_
+ *
+ * @param an_entry to be removed
+ * @post if the bag is unordered, the last entry of the array is moved to the index of the removed item in O(1),
+ * otherwise every later entry is shifted left by one
+ * @return true if an_entry was successfully removed from elements_,
+ * @return false otherwise
+ */
+template <class ItemType, int InlineCapacity>
+bool IndexedArrayBag<ItemType, InlineCapacity>::removeInstanceOf(const ItemType &an_entry)
+{
+    auto found = positions_.find(an_entry);
+    if (found == positions_.end() || found->second.empty())
+    {
+        return false;
+    }
+
+    // The entries are about to be moved around, so make sure no snapshot sees it
+    this->detach();
+
+    int last_index = this->item_count_ - 1;
+    if (!this->ordered_)
+    {
+        // Any instance will do - take the cheapest one to unlink and fill the hole with the last entry
+        int move_index = found->second.back();
+        unindexEntry(move_index);
+        if (move_index != last_index)
+        {
+            this->elements_[move_index] = std::move(this->elements_[last_index]);
+            reindexEntry(last_index, move_index);
+        }
+    }
+    else
+    {
+        // Remove the first instance and shift every later entry left by one
+        int move_index = getIndexOf(an_entry);
+        unindexEntry(move_index);
+        for (int i = move_index + 1; i <= last_index; i++)
+        {
+            this->elements_[i - 1] = std::move(this->elements_[i]);
+            reindexEntry(i, i - 1);
+        }
+    }
+
+    this->item_count_--;
+    this->elements_[this->item_count_].~ItemType();
+    slots_.pop_back();
+    return true;
+}
+
+/**
+ * @brief removes every instance of an_entry from elements_ in a single pass
+ *
+ * @param an_entry to be removed
+ * @note when the bag is unordered this only touches the instances of an_entry and the entries moved into their place
+ * @return the number of entries removed
+ */
+template <class ItemType, int InlineCapacity>
+int IndexedArrayBag<ItemType, InlineCapacity>::removeAllInstancesOf(const ItemType &an_entry)
+{
+    int frequency = getFrequencyOf(an_entry);
+    if (frequency == 0)
+    {
+        return 0;
+    }
+
+    if (!this->ordered_)
+    {
+        for (int i = 0; i < frequency; i++)
+        {
+            removeInstanceOf(an_entry);
+        }
+        return frequency;
+    }
+
+    int removed = ArrayBag<ItemType, InlineCapacity>::removeAllInstancesOf(an_entry);
+    rebuildIndex();
+    return removed;
+}
+
+/**
+ * @brief removes every entry for which predicate returns true in a single pass
+ *
+ * @param predicate to be called once on each entry
+ * @post if the bag is ordered, the remaining entries keep their relative order
+ * @return the number of entries removed
+ */
+template <class ItemType, int InlineCapacity>
+template <class Predicate>
+int IndexedArrayBag<ItemType, InlineCapacity>::remove_if(Predicate predicate)
+{
+    int removed = ArrayBag<ItemType, InlineCapacity>::remove_if(predicate);
+    if (removed > 0)
+    {
+        rebuildIndex();
+    }
+    return removed;
+}
+
+/**
+ * @brief makes the array empty
+ *
+ * @post every entry is destroyed and the index is emptied
+ */
+template <class ItemType, int InlineCapacity>
+void IndexedArrayBag<ItemType, InlineCapacity>::clear()
+{
+    ArrayBag<ItemType, InlineCapacity>::clear();
+    positions_.clear();
+    slots_.clear();
+}
+
+/**
+ * @brief Allows direct element access using the [] operator
+ *
+ * @param i is the index in the array
+ * @note Bounds-checking is NOT performed -> Be sure to avoid using indexes greater than or equal to item_count_
+ * @return a read-only reference to the item at the location specified by the parameter
+ */
+template <class ItemType, int InlineCapacity>
+const ItemType &IndexedArrayBag<ItemType, InlineCapacity>::operator[](int i) const
+{
+    return this->elements_[i];
+}
+
+/**
+ * @brief gets a read-only iterator to the first entry
+ *
+ * @note only read-only iteration is offered - writing through it would bypass the index
+ * @return a pointer to the first entry of elements_
+ */
+template <class ItemType, int InlineCapacity>
+typename IndexedArrayBag<ItemType, InlineCapacity>::const_iterator IndexedArrayBag<ItemType, InlineCapacity>::begin() const
+{
+    return ArrayBag<ItemType, InlineCapacity>::begin();
+}
+
+/**
+ * @brief gets a read-only iterator past the last entry
+ *
+ * @return a pointer past the last entry of elements_
+ */
+template <class ItemType, int InlineCapacity>
+typename IndexedArrayBag<ItemType, InlineCapacity>::const_iterator IndexedArrayBag<ItemType, InlineCapacity>::end() const
+{
+    return ArrayBag<ItemType, InlineCapacity>::end();
+}
+
+/**
+ * @brief gets read-only access to the underlying array
+ *
+ * @return a pointer to elements_, valid until the bag next grows or shrinks
+ */
+template <class ItemType, int InlineCapacity>
+const ItemType *IndexedArrayBag<ItemType, InlineCapacity>::data() const
+{
+    return this->elements_;
+}
+
+//********* PRIVATE METHODS **************//
+
+/**
+ * @brief Get the index of target in elements_
+ *
+ * @param target to be found in elements_
+ * @return either the lowest index of target in elements_,
+ * @return -1 if elements_ does not contain the target
+ */
+template <class ItemType, int InlineCapacity>
+int IndexedArrayBag<ItemType, InlineCapacity>::getIndexOf(const ItemType &target) const
+{
+    auto found = positions_.find(target);
+    if (found == positions_.end() || found->second.empty())
+    {
+        return -1;
+    }
+    return *std::min_element(found->second.begin(), found->second.end());
+}
+
+/**
+ * @brief adds the entry at index to the index
+ *
+ * @param index of an entry that is not indexed yet
+ * @note an entry that does not compare equal to itself is left out, with slots_[index] set to -1
+ */
+template <class ItemType, int InlineCapacity>
+void IndexedArrayBag<ItemType, InlineCapacity>::indexEntry(const int &index)
+{
+    if (index >= static_cast<int>(slots_.size()))
+    {
+        slots_.resize(index + 1);
+    }
+    const ItemType &entry = this->elements_[index];
+    if (!(entry == entry))
+    {
+        // No query can match it, and the hash map could never find it again to unindex it
+        slots_[index] = -1;
+        return;
+    }
+    std::vector<int> &position_list = positions_[entry];
+    position_list.push_back(index);
+    slots_[index] = static_cast<int>(position_list.size()) - 1;
+}
+
+/**
+ * @brief removes the entry at index from the index
+ *
+ * @param index of an entry added with indexEntry()
+ */
+template <class ItemType, int InlineCapacity>
+void IndexedArrayBag<ItemType, InlineCapacity>::unindexEntry(const int &index)
+{
+    int slot = slots_[index];
+    if (slot < 0)
+    {
+        return;
+    }
+    auto found = positions_.find(this->elements_[index]);
+    if (found == positions_.end())
+    {
+        return;
+    }
+    std::vector<int> &position_list = found->second;
+
+    // Swap-remove index from its position list and fix up the slot of the position that took its place
+    int moved_index = position_list.back();
+    position_list[slot] = moved_index;
+    slots_[moved_index] = slot;
+    position_list.pop_back();
+
+    if (position_list.empty())
+    {
+        positions_.erase(found);
+    }
+}
+
+/**
+ * @brief records that the entry indexed at old_index has been moved to new_index
+ *
+ * @param old_index the entry used to be indexed at
+ * @param new_index the entry now lives at
+ */
+template <class ItemType, int InlineCapacity>
+void IndexedArrayBag<ItemType, InlineCapacity>::reindexEntry(const int &old_index, const int &new_index)
+{
+    int slot = slots_[old_index];
+    slots_[new_index] = slot;
+    if (slot >= 0)
+    {
+        positions_.find(this->elements_[new_index])->second[slot] = new_index;
+    }
+}
+
+/**
+ * @brief throws away the index and indexes every entry again
+ */
+template <class ItemType, int InlineCapacity>
+void IndexedArrayBag<ItemType, InlineCapacity>::rebuildIndex()
+{
+    positions_.clear();
+    slots_.clear();
+    slots_.reserve(this->item_count_);
+    for (int i = 0; i < this->item_count_; i++)
+    {
+        indexEntry(i);
+    }
+}
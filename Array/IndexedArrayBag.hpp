@@ -0,0 +1,234 @@
+/**
+ * @file IndexedArrayBag.hpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Interface for IndexedArrayBag class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef INDEXED_ARRAY_BAG_
+#define INDEXED_ARRAY_BAG_
+
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include "ArrayBag.hpp"
+
+/**
+ * @brief An ArrayBag that also keeps a hash index from each value to the positions holding it, so that
+ * getFrequencyOf() and contains() run in O(1) while the entries stay contiguous for iteration
+ *
+ * @note ItemType must be hashable with std::hash
+ * @note Entries can only be read through operator[] - writing through a reference would bypass the index
+ * @note The ArrayBag is inherited privately, so the bag cannot be modified through an ArrayBag reference behind the
+ * index's back - only the operations that keep the index up to date are offered
+ * @note Entries that do not compare equal to themselves (such as NaN) are stored but never indexed - like in ArrayBag,
+ * no query finds them, and they can only be removed by pop_back(), remove_if() or clear()
+ */
+template <class ItemType, int InlineCapacity = 0>
+class IndexedArrayBag : private ArrayBag<ItemType, InlineCapacity>
+{
+public:
+    using typename ArrayBag<ItemType, InlineCapacity>::value_type;
+    using typename ArrayBag<ItemType, InlineCapacity>::size_type;
+    using typename ArrayBag<ItemType, InlineCapacity>::const_reference;
+    using typename ArrayBag<ItemType, InlineCapacity>::const_iterator;
+
+    // Operations that cannot desync the index from elements_
+    using ArrayBag<ItemType, InlineCapacity>::getCurrentSize;
+    using ArrayBag<ItemType, InlineCapacity>::getCurrentCapacity;
+    using ArrayBag<ItemType, InlineCapacity>::isEmpty;
+    using ArrayBag<ItemType, InlineCapacity>::reserve;
+    using ArrayBag<ItemType, InlineCapacity>::shrink_to_fit;
+    using ArrayBag<ItemType, InlineCapacity>::cbegin;
+    using ArrayBag<ItemType, InlineCapacity>::cend;
+    using ArrayBag<ItemType, InlineCapacity>::setOrdered;
+    using ArrayBag<ItemType, InlineCapacity>::isOrdered;
+    using ArrayBag<ItemType, InlineCapacity>::snapshot;
+    using ArrayBag<ItemType, InlineCapacity>::isShared;
+    using ArrayBag<ItemType, InlineCapacity>::isInline;
+    using ArrayBag<ItemType, InlineCapacity>::getMemoryResource;
+
+    /**
+     * @brief default constructor
+     */
+    IndexedArrayBag();
+
+    /**
+     * @brief parameterized constructor
+     *
+     * @param array_size whose value will determine the capacity of the array size at instantiation time
+     * @param memory_resource to allocate every heap buffer from
+     */
+    IndexedArrayBag(const int &array_size, std::pmr::memory_resource *memory_resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief gets the frequency of an object
+     *
+     * @param an_entry whose intances in elements_ are to be counted up
+     * @return the number of times an_entry is found
+     */
+    int getFrequencyOf(const ItemType &an_entry) const;
+
+    /**
+     * @brief locates an_entry
+     *
+     * @param an_entry to be located in elements_
+     * @return true if an_entry is found in elements_,
+     * @return false otherwise
+     */
+    bool contains(const ItemType &an_entry) const;
+
+    /**
+     * @brief adds new_entry into elements_
+     *
+     * @param new_entry to insert into elements_
+     * @return true if new_entry was successfully added to elements_,
+     * @return false otherwise
+     */
+    bool push_back(const ItemType &new_entry);
+
+    /**
+     * @brief moves new_entry into elements_
+     *
+     * @param new_entry to be moved to the back of elements_
+     * @return true if new_entry was successfully added to elements_,
+     * @return false otherwise
+     */
+    bool push_back(ItemType &&new_entry);
+
+    /**
+     * @brief constructs a new entry in place at the back of elements_
+     *
+     * @param args to be forwarded to the constructor of ItemType
+     * @return a read-only reference to the new entry
+     */
+    template <class... Args>
+    const ItemType &emplace_back(Args &&...args);
+
+    /**
+     * @brief removes the last entry in the array
+     *
+     * @return true if the last entry in the array was removed,
+     * @return false otherwise
+     */
+    bool pop_back();
+
+    /**
+     * @brief finds and removes an_entry from elements_
+     *
+     * @param an_entry to be removed
+     * @post if the bag is unordered, the last entry of the array is moved to the index of the removed item in O(1),
+     * otherwise every later entry is shifted left by one
+     * @return true if an_entry was successfully removed from elements_,
+     * @return false otherwise
+     */
+    bool removeInstanceOf(const ItemType &an_entry);
+
+    /**
+     * @brief removes every instance of an_entry from elements_ in a single pass
+     *
+     * @param an_entry to be removed
+     * @return the number of entries removed
+     */
+    int removeAllInstancesOf(const ItemType &an_entry);
+
+    /**
+     * @brief removes every entry for which predicate returns true in a single pass
+     *
+     * @param predicate to be called once on each entry
+     * @post if the bag is ordered, the remaining entries keep their relative order
+     * @return the number of entries removed
+     */
+    template <class Predicate>
+    int remove_if(Predicate predicate);
+
+    /**
+     * @brief makes the array empty
+     *
+     * @post every entry is destroyed and the index is emptied
+     */
+    void clear();
+
+    /**
+     * @brief Allows direct element access using the [] operator
+     *
+     * @param i is the index in the array
+     * @note Bounds-checking is NOT performed -> Be sure to avoid using indexes greater than or equal to item_count_
+     * @return a read-only reference to the item at the location specified by the parameter
+     */
+    const ItemType &operator[](int i) const;
+
+    /**
+     * @brief gets a read-only iterator to the first entry
+     *
+     * @note only read-only iteration is offered - writing through it would bypass the index
+     * @return a pointer to the first entry of elements_
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief gets a read-only iterator past the last entry
+     *
+     * @return a pointer past the last entry of elements_
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief gets read-only access to the underlying array
+     *
+     * @return a pointer to elements_, valid until the bag next grows or shrinks
+     */
+    const ItemType *data() const;
+
+protected:
+    // Maps each value to the indexes of elements_ holding it
+    std::unordered_map<ItemType, std::vector<int>> positions_;
+
+    // slots_[i] is where index i is stored within the position list of elements_[i], or -1 if elements_[i] is not indexed
+    std::vector<int> slots_;
+
+    /**
+     * @brief Get the index of target in elements_
+     *
+     * @param target to be found in elements_
+     * @return either the lowest index of target in elements_,
+     * @return -1 if elements_ does not contain the target
+     */
+    int getIndexOf(const ItemType &target) const;
+
+    /**
+     * @brief adds the entry at index to the index
+     *
+     * @param index of an entry that is not indexed yet
+     * @note an entry that does not compare equal to itself is left out, with slots_[index] set to -1
+     */
+    void indexEntry(const int &index);
+
+    /**
+     * @brief removes the entry at index from the index
+     *
+     * @param index of an entry added with indexEntry()
+     */
+    void unindexEntry(const int &index);
+
+    /**
+     * @brief records that the entry indexed at old_index has been moved to new_index
+     *
+     * @param old_index the entry used to be indexed at
+     * @param new_index the entry now lives at
+     */
+    void reindexEntry(const int &old_index, const int &new_index);
+
+    /**
+     * @brief throws away the index and indexes every entry again
+     */
+    void rebuildIndex();
+};
+
+#include "IndexedArrayBag.cpp"
+#endif
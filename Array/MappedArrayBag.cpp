@@ -0,0 +1,459 @@
+/**
+ * @file MappedArrayBag.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Implementation for MappedArrayBag class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "MappedArrayBag.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+/**
+ * @brief opens the bag stored in file_path, or creates an empty one if the file does not exist
+ *
+ * @param file_path of the backing file
+ * @param array_size the initial capacity if the file is created
+ * @note throws std::runtime_error if the file cannot be opened or mapped, or if it holds a different kind of bag
+ */
+template <class ItemType>
+MappedArrayBag<ItemType>::MappedArrayBag(const std::string &file_path, const std::int64_t &array_size) : file_descriptor_{-1},
+                                                                                                       mapped_size_{0},
+                                                                                                       header_{nullptr},
+                                                                                                       elements_{nullptr}
+{
+    file_descriptor_ = ::open(file_path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (file_descriptor_ < 0)
+    {
+        fail("cannot open " + file_path);
+    }
+
+    try
+    {
+        struct stat file_status;
+        if (::fstat(file_descriptor_, &file_status) != 0)
+        {
+            fail("cannot stat " + file_path);
+        }
+
+        if (file_status.st_size == 0)
+        {
+            // New file - lay out an empty bag
+            if (array_size > MAX_ARRAY_SIZE_)
+            {
+                throw std::length_error("MappedArrayBag");
+            }
+            std::int64_t capacity = array_size > 0 ? array_size : DEFAULT_ARRAY_SIZE_;
+            if (::ftruncate(file_descriptor_, getFileSize(capacity)) != 0)
+            {
+                fail("cannot size " + file_path);
+            }
+            map(getFileSize(capacity));
+            header_->magic = MAGIC_;
+            header_->item_size = sizeof(ItemType);
+            header_->item_count = 0;
+            header_->array_capacity = capacity;
+        }
+        else
+        {
+            // Existing file - map it as it is, then make sure it holds this kind of bag
+            if (static_cast<std::size_t>(file_status.st_size) < sizeof(Header))
+            {
+                throw std::runtime_error(file_path + " is not a MappedArrayBag file");
+            }
+            map(file_status.st_size);
+            if (header_->magic != MAGIC_ || header_->item_size != sizeof(ItemType) ||
+                header_->item_count < 0 || header_->item_count > header_->array_capacity ||
+                header_->array_capacity > MAX_ARRAY_SIZE_ || getFileSize(header_->array_capacity) > static_cast<std::size_t>(file_status.st_size))
+            {
+                throw std::runtime_error(file_path + " does not hold a MappedArrayBag of this item type");
+            }
+        }
+    }
+    catch (...)
+    {
+        close();
+        throw;
+    }
+}
+
+/**
+ * @brief move constructor
+ *
+ * @param a_bag whose mapping is taken over
+ */
+template <class ItemType>
+MappedArrayBag<ItemType>::MappedArrayBag(MappedArrayBag<ItemType> &&a_bag) noexcept : file_descriptor_{a_bag.file_descriptor_},
+                                                                                   mapped_size_{a_bag.mapped_size_},
+                                                                                   header_{a_bag.header_},
+                                                                                   elements_{a_bag.elements_}
+{
+    a_bag.file_descriptor_ = -1;
+    a_bag.mapped_size_ = 0;
+    a_bag.header_ = nullptr;
+    a_bag.elements_ = nullptr;
+}
+
+/**
+ * @brief move assignment operator
+ *
+ * @param a_bag whose mapping is taken over
+ * @return a reference to this bag
+ */
+template <class ItemType>
+MappedArrayBag<ItemType> &MappedArrayBag<ItemType>::operator=(MappedArrayBag<ItemType> &&a_bag) noexcept
+{
+    if (this != &a_bag)
+    {
+        close();
+        file_descriptor_ = a_bag.file_descriptor_;
+        mapped_size_ = a_bag.mapped_size_;
+        header_ = a_bag.header_;
+        elements_ = a_bag.elements_;
+
+        a_bag.file_descriptor_ = -1;
+        a_bag.mapped_size_ = 0;
+        a_bag.header_ = nullptr;
+        a_bag.elements_ = nullptr;
+    }
+    return *this;
+}
+
+/**
+ * @brief destructor - unmaps and closes the file, leaving the entries on disk
+ */
+template <class ItemType>
+MappedArrayBag<ItemType>::~MappedArrayBag()
+{
+    close();
+}
+
+/**
+ * @brief gets the current size of the bag
+ *
+ * @return the current size of the bag
+ */
+template <class ItemType>
+std::int64_t MappedArrayBag<ItemType>::getCurrentSize() const
+{
+    return header_->item_count;
+}
+
+/**
+ * @brief gets the current capacity of the mapped array
+ *
+ * @return the number of entries the file has room for
+ */
+template <class ItemType>
+std::int64_t MappedArrayBag<ItemType>::getCurrentCapacity() const
+{
+    return header_->array_capacity;
+}
+
+/**
+ * @brief gets the frequency of an object
+ *
+ * @param an_entry whose intances are to be counted up
+ * @return the number of times an_entry is found
+ */
+template <class ItemType>
+std::int64_t MappedArrayBag<ItemType>::getFrequencyOf(const ItemType &an_entry) const
+{
+    std::int64_t frequency = 0;
+    for (std::int64_t first = 0; first < header_->item_count; first += SEARCH_RUN_SIZE_)
+    {
+        int run_size = static_cast<int>(std::min(SEARCH_RUN_SIZE_, header_->item_count - first));
+        frequency += SimdSearch<ItemType>::frequencyOf(elements_ + first, run_size, an_entry);
+    }
+    return frequency;
+}
+
+/**
+ * @brief checks if the bag is empty
+ *
+ * @return true if the item count is 0,
+ * @return false otherwise
+ */
+template <class ItemType>
+bool MappedArrayBag<ItemType>::isEmpty() const
+{
+    return header_->item_count == 0;
+}
+
+/**
+ * @brief locates an_entry
+ *
+ * @param an_entry to be located
+ * @return true if an_entry is found,
+ * @return false otherwise
+ */
+template <class ItemType>
+bool MappedArrayBag<ItemType>::contains(const ItemType &an_entry) const
+{
+    return getIndexOf(an_entry) > -1;
+}
+
+/**
+ * @brief adds new_entry at the end of the mapped array
+ *
+ * @param new_entry to insert
+ * @return true always - the file is extended if the array is full
+ * @note throws std::length_error if the array is full and cannot grow any further
+ */
+template <class ItemType>
+bool MappedArrayBag<ItemType>::push_back(const ItemType &new_entry)
+{
+    if (header_->item_count >= header_->array_capacity)
+    {
+        if (header_->array_capacity >= MAX_ARRAY_SIZE_)
+        {
+            throw std::length_error("MappedArrayBag");
+        }
+
+        // Copy first - new_entry may live in the mapping that is about to move
+        ItemType entry = new_entry;
+        grow(header_->array_capacity <= MAX_ARRAY_SIZE_ / 2 ? header_->array_capacity * 2 : MAX_ARRAY_SIZE_);
+        elements_[header_->item_count] = entry;
+    }
+    else
+    {
+        elements_[header_->item_count] = new_entry;
+    }
+    header_->item_count++;
+    return true;
+}
+
+/**
+ * @brief removes the last entry in the array
+ *
+ * @return true if the last entry in the array was removed,
+ * @return false otherwise
+ */
+template <class ItemType>
+bool MappedArrayBag<ItemType>::pop_back()
+{
+    if (isEmpty())
+    {
+        return false;
+    }
+    header_->item_count--;
+    return true;
+}
+
+/**
+ * @brief finds and removes an_entry
+ *
+ * @param an_entry to be removed
+ * @post every later entry is shifted left by one
+ * @return true if an_entry was successfully removed,
+ * @return false otherwise
+ */
+template <class ItemType>
+bool MappedArrayBag<ItemType>::removeInstanceOf(const ItemType &an_entry)
+{
+    std::int64_t move_index = getIndexOf(an_entry);
+    if (move_index < 0)
+    {
+        return false;
+    }
+    std::memmove(static_cast<void *>(elements_ + move_index), static_cast<const void *>(elements_ + move_index + 1),
+                 sizeof(ItemType) * (header_->item_count - move_index - 1));
+    header_->item_count--;
+    return true;
+}
+
+/**
+ * @brief makes the array empty
+ *
+ * @post the file keeps its size, so the capacity is kept for reuse
+ */
+template <class ItemType>
+void MappedArrayBag<ItemType>::clear()
+{
+    header_->item_count = 0;
+}
+
+/**
+ * @brief makes sure the file has room for at least new_capacity entries
+ *
+ * @param new_capacity the minimum capacity of the mapped array
+ * @note throws std::length_error if new_capacity entries would not fit in the address space
+ */
+template <class ItemType>
+void MappedArrayBag<ItemType>::reserve(const std::int64_t &new_capacity)
+{
+    if (new_capacity > MAX_ARRAY_SIZE_)
+    {
+        throw std::length_error("MappedArrayBag");
+    }
+    if (new_capacity > header_->array_capacity)
+    {
+        grow(new_capacity);
+    }
+}
+
+/**
+ * @brief writes every modified page back to the file and waits for it to finish
+ *
+ * @note not needed for the entries to survive the process - only to survive a crash of the machine
+ */
+template <class ItemType>
+void MappedArrayBag<ItemType>::flush()
+{
+    if (::msync(header_, mapped_size_, MS_SYNC) != 0)
+    {
+        fail("cannot flush mapping");
+    }
+}
+
+/**
+ * @brief Allows direct element access using the [] operator
+ *
+ * @param i is the index in the array
+ * @note Bounds-checking is NOT performed -> Be sure to avoid using indexes greater than or equal to the item count
+ * @return a read-only reference to the item at the location specified by the parameter
+ */
+template <class ItemType>
+const ItemType &MappedArrayBag<ItemType>::operator[](std::int64_t i) const
+{
+    return elements_[i];
+}
+
+/**
+ * @brief Allows direct element access using the [] operator
+ *
+ * @param i is the index in the array
+ * @note Bounds-checking is NOT performed -> Be sure to avoid using indexes greater than or equal to the item count
+ * @return a reference to the item at the location specified by the parameter
+ */
+template <class ItemType>
+ItemType &MappedArrayBag<ItemType>::operator[](std::int64_t i)
+{
+    return elements_[i];
+}
+
+//********* PRIVATE METHODS **************//
+
+/**
+ * @brief gets the number of bytes the file needs to hold capacity entries
+ *
+ * @param capacity of the array
+ * @return the size of the header plus capacity entries
+ */
+template <class ItemType>
+std::size_t MappedArrayBag<ItemType>::getFileSize(const std::int64_t &capacity)
+{
+    return sizeof(Header) + sizeof(ItemType) * static_cast<std::size_t>(capacity);
+}
+
+/**
+ * @brief maps the first file_size bytes of the file and points header_ and elements_ at them
+ *
+ * @param file_size the number of bytes to map
+ */
+template <class ItemType>
+void MappedArrayBag<ItemType>::map(const std::size_t &file_size)
+{
+    void *mapping = ::mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor_, 0);
+    if (mapping == MAP_FAILED)
+    {
+        fail("cannot map file");
+    }
+    mapped_size_ = file_size;
+    header_ = static_cast<Header *>(mapping);
+    elements_ = reinterpret_cast<ItemType *>(static_cast<unsigned char *>(mapping) + sizeof(Header));
+}
+
+/**
+ * @brief extends the file to hold new_capacity entries and maps the larger file
+ *
+ * @pre new_capacity <= MAX_ARRAY_SIZE_
+ * @param new_capacity of the array
+ */
+template <class ItemType>
+void MappedArrayBag<ItemType>::grow(const std::int64_t &new_capacity)
+{
+    std::size_t new_size = getFileSize(new_capacity);
+
+    // The kernel keeps the pages in its cache, so nothing is copied - only the file length and the mapping change
+    if (::ftruncate(file_descriptor_, static_cast<off_t>(new_size)) != 0)
+    {
+        fail("cannot extend file");
+    }
+
+#ifdef MREMAP_MAYMOVE
+    void *mapping = ::mremap(header_, mapped_size_, new_size, MREMAP_MAYMOVE);
+    if (mapping == MAP_FAILED)
+    {
+        fail("cannot remap file");
+    }
+    mapped_size_ = new_size;
+    header_ = static_cast<Header *>(mapping);
+    elements_ = reinterpret_cast<ItemType *>(static_cast<unsigned char *>(mapping) + sizeof(Header));
+#else
+    ::munmap(header_, mapped_size_);
+    header_ = nullptr;
+    map(new_size);
+#endif
+
+    header_->array_capacity = new_capacity;
+}
+
+/**
+ * @brief finds the first entry equal to an_entry, searching the array one run at a time
+ *
+ * @param an_entry to be found
+ * @return either the lowest index of an_entry,
+ * @return -1 if the bag does not contain it
+ */
+template <class ItemType>
+std::int64_t MappedArrayBag<ItemType>::getIndexOf(const ItemType &an_entry) const
+{
+    for (std::int64_t first = 0; first < header_->item_count; first += SEARCH_RUN_SIZE_)
+    {
+        int run_size = static_cast<int>(std::min(SEARCH_RUN_SIZE_, header_->item_count - first));
+        int index = SimdSearch<ItemType>::indexOf(elements_ + first, run_size, an_entry);
+        if (index > -1)
+        {
+            return first + index;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief unmaps and closes the file, if any
+ */
+template <class ItemType>
+void MappedArrayBag<ItemType>::close()
+{
+    if (header_ != nullptr)
+    {
+        // Unmap what was actually mapped - the header is not trusted if the file was rejected
+        ::munmap(header_, mapped_size_);
+        mapped_size_ = 0;
+        header_ = nullptr;
+        elements_ = nullptr;
+    }
+    if (file_descriptor_ >= 0)
+    {
+        ::close(file_descriptor_);
+        file_descriptor_ = -1;
+    }
+}
+
+/**
+ * @brief throws std::runtime_error describing the failed system call
+ *
+ * @param what the bag was trying to do
+ */
+template <class ItemType>
+void MappedArrayBag<ItemType>::fail(const std::string &what)
+{
+    throw std::runtime_error("MappedArrayBag: " + what + ": " + std::strerror(errno));
+}
@@ -0,0 +1,253 @@
+/**
+ * @file MappedArrayBag.hpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Interface for MappedArrayBag class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef MAPPED_ARRAY_BAG_
+#define MAPPED_ARRAY_BAG_
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "MappedArrayBag needs POSIX mmap"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "SimdSearch.hpp"
+
+/**
+ * @brief A bag whose array lives in a memory-mapped file, so that it survives the process and can be reopened
+ * without reading or copying a single entry
+ *
+ * @note ItemType must be trivially copyable, since its bytes are written to disk as they are
+ * @note The file starts with a small header holding the item count and the array capacity. Growing the bag extends
+ * the file and remaps it instead of copying the array
+ * @note Sizes and indices are 64-bit, so a bag is limited by the address space rather than by INT_MAX entries
+ */
+template <class ItemType>
+class MappedArrayBag
+{
+    static_assert(std::is_trivially_copyable<ItemType>::value, "MappedArrayBag can only hold trivially copyable items");
+
+public:
+    /**
+     * @brief opens the bag stored in file_path, or creates an empty one if the file does not exist
+     *
+     * @param file_path of the backing file
+     * @param array_size the initial capacity if the file is created
+     * @note throws std::runtime_error if the file cannot be opened or mapped, or if it holds a different kind of bag
+     */
+    MappedArrayBag(const std::string &file_path, const std::int64_t &array_size = DEFAULT_ARRAY_SIZE_);
+
+    MappedArrayBag(const MappedArrayBag<ItemType> &a_bag) = delete;
+    MappedArrayBag<ItemType> &operator=(const MappedArrayBag<ItemType> &a_bag) = delete;
+
+    /**
+     * @brief move constructor
+     *
+     * @param a_bag whose mapping is taken over
+     */
+    MappedArrayBag(MappedArrayBag<ItemType> &&a_bag) noexcept;
+
+    /**
+     * @brief move assignment operator
+     *
+     * @param a_bag whose mapping is taken over
+     * @return a reference to this bag
+     */
+    MappedArrayBag<ItemType> &operator=(MappedArrayBag<ItemType> &&a_bag) noexcept;
+
+    /**
+     * @brief destructor - unmaps and closes the file, leaving the entries on disk
+     */
+    ~MappedArrayBag();
+
+    /**
+     * @brief gets the current size of the bag
+     *
+     * @return the current size of the bag
+     */
+    std::int64_t getCurrentSize() const;
+
+    /**
+     * @brief gets the current capacity of the mapped array
+     *
+     * @return the number of entries the file has room for
+     */
+    std::int64_t getCurrentCapacity() const;
+
+    /**
+     * @brief gets the frequency of an object
+     *
+     * @param an_entry whose intances are to be counted up
+     * @return the number of times an_entry is found
+     */
+    std::int64_t getFrequencyOf(const ItemType &an_entry) const;
+
+    /**
+     * @brief checks if the bag is empty
+     *
+     * @return true if the item count is 0,
+     * @return false otherwise
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief locates an_entry
+     *
+     * @param an_entry to be located
+     * @return true if an_entry is found,
+     * @return false otherwise
+     */
+    bool contains(const ItemType &an_entry) const;
+
+    /**
+     * @brief adds new_entry at the end of the mapped array
+     *
+     * @param new_entry to insert
+     * @return true always - the file is extended if the array is full
+     * @note throws std::length_error if the array is full and cannot grow any further
+     */
+    bool push_back(const ItemType &new_entry);
+
+    /**
+     * @brief removes the last entry in the array
+     *
+     * @return true if the last entry in the array was removed,
+     * @return false otherwise
+     */
+    bool pop_back();
+
+    /**
+     * @brief finds and removes an_entry
+     *
+     * @param an_entry to be removed
+     * @post every later entry is shifted left by one
+     * @return true if an_entry was successfully removed,
+     * @return false otherwise
+     */
+    bool removeInstanceOf(const ItemType &an_entry);
+
+    /**
+     * @brief makes the array empty
+     *
+     * @post the file keeps its size, so the capacity is kept for reuse
+     */
+    void clear();
+
+    /**
+     * @brief makes sure the file has room for at least new_capacity entries
+     *
+     * @param new_capacity the minimum capacity of the mapped array
+     * @note throws std::length_error if new_capacity entries would not fit in the address space
+     */
+    void reserve(const std::int64_t &new_capacity);
+
+    /**
+     * @brief writes every modified page back to the file and waits for it to finish
+     *
+     * @note not needed for the entries to survive the process - only to survive a crash of the machine
+     */
+    void flush();
+
+    /**
+     * @brief Allows direct element access using the [] operator
+     *
+     * @param i is the index in the array
+     * @note Bounds-checking is NOT performed -> Be sure to avoid using indexes greater than or equal to the item count
+     * @return a read-only reference to the item at the location specified by the parameter
+     */
+    const ItemType &operator[](std::int64_t i) const;
+
+    /**
+     * @brief Allows direct element access using the [] operator
+     *
+     * @param i is the index in the array
+     * @note Bounds-checking is NOT performed -> Be sure to avoid using indexes greater than or equal to the item count
+     * @return a reference to the item at the location specified by the parameter
+     */
+    ItemType &operator[](std::int64_t i);
+
+private:
+    /**
+     * @brief the layout of the start of the file - padded so that the entries after it stay aligned
+     */
+    struct alignas(64) Header
+    {
+        std::uint64_t magic;
+        std::uint32_t item_size;
+        std::int64_t item_count;
+        std::int64_t array_capacity;
+    };
+
+    static constexpr std::uint64_t MAGIC_ = 0x3247425941525241ULL; // "ARRAYBG2" read as a little-endian integer
+    static constexpr std::int64_t DEFAULT_ARRAY_SIZE_ = 1;
+    // The most entries a mapping can hold - its size must fit in a ptrdiff_t
+    static constexpr std::int64_t MAX_ARRAY_SIZE_ = static_cast<std::int64_t>((PTRDIFF_MAX - sizeof(Header)) / sizeof(ItemType));
+    // SimdSearch counts in int, so longer arrays are searched in runs of this many entries
+    static constexpr std::int64_t SEARCH_RUN_SIZE_ = 1 << 30;
+
+    int file_descriptor_;
+    std::size_t mapped_size_;
+    Header *header_;
+    ItemType *elements_;
+
+    /**
+     * @brief gets the number of bytes the file needs to hold capacity entries
+     *
+     * @param capacity of the array
+     * @return the size of the header plus capacity entries
+     */
+    static std::size_t getFileSize(const std::int64_t &capacity);
+
+    /**
+     * @brief maps the first file_size bytes of the file and points header_ and elements_ at them
+     *
+     * @param file_size the number of bytes to map
+     */
+    void map(const std::size_t &file_size);
+
+    /**
+     * @brief extends the file to hold new_capacity entries and maps the larger file
+     *
+     * @pre new_capacity <= MAX_ARRAY_SIZE_
+     * @param new_capacity of the array
+     */
+    void grow(const std::int64_t &new_capacity);
+
+    /**
+     * @brief finds the first entry equal to an_entry, searching the array one run at a time
+     *
+     * @param an_entry to be found
+     * @return either the lowest index of an_entry,
+     * @return -1 if the bag does not contain it
+     */
+    std::int64_t getIndexOf(const ItemType &an_entry) const;
+
+    /**
+     * @brief unmaps and closes the file, if any
+     */
+    void close();
+
+    /**
+     * @brief throws std::runtime_error describing the failed system call
+     *
+     * @param what the bag was trying to do
+     */
+    [[noreturn]] static void fail(const std::string &what);
+};
+
+#include "MappedArrayBag.cpp"
+#endif
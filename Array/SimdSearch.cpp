@@ -0,0 +1,524 @@
+/**
+ * @file SimdSearch.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Implementation for SimdSearch class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "SimdSearch.hpp"
+
+/**
+ * @brief counts the entries of elements equal to target
+ *
+ * @param elements to be searched
+ * @param count the number of entries in elements
+ * @param target whose instances are to be counted up
+ * @return the number of times target is found
+ */
+template <class ItemType>
+int SimdSearch<ItemType>::frequencyOf(const ItemType *elements, int count, const ItemType &target)
+{
+#ifdef SIMD_SEARCH_X86_
+    if constexpr (IS_VECTORIZABLE_)
+    {
+        if (hasAvx2())
+        {
+            return frequencyOfAvx2(elements, count, target);
+        }
+        if (hasSse42())
+        {
+            return frequencyOfSse42(elements, count, target);
+        }
+    }
+#endif
+    return frequencyOfScalar(elements, count, target);
+}
+
+/**
+ * @brief finds the first entry of elements equal to target
+ *
+ * @param elements to be searched
+ * @param count the number of entries in elements
+ * @param target to be found
+ * @return either the lowest index of target in elements,
+ * @return -1 if elements does not contain the target
+ */
+template <class ItemType>
+int SimdSearch<ItemType>::indexOf(const ItemType *elements, int count, const ItemType &target)
+{
+#ifdef SIMD_SEARCH_X86_
+    if constexpr (IS_VECTORIZABLE_)
+    {
+        if (hasAvx2())
+        {
+            return indexOfAvx2(elements, count, target);
+        }
+        if (hasSse42())
+        {
+            return indexOfSse42(elements, count, target);
+        }
+    }
+#endif
+    return indexOfScalar(elements, count, target);
+}
+
+//********* PRIVATE METHODS **************//
+
+/**
+ * @brief scalar fallback used for every type the vectorized kernels cannot handle
+ */
+template <class ItemType>
+int SimdSearch<ItemType>::frequencyOfScalar(const ItemType *elements, int count, const ItemType &target)
+{
+    int frequency = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (elements[i] == target)
+        {
+            frequency++;
+        }
+    }
+    return frequency;
+}
+
+/**
+ * @brief scalar fallback used for every type the vectorized kernels cannot handle
+ */
+template <class ItemType>
+int SimdSearch<ItemType>::indexOfScalar(const ItemType *elements, int count, const ItemType &target)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (elements[i] == target)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#ifdef SIMD_SEARCH_X86_
+
+/**
+ * @brief checks (once) whether the CPU supports AVX2
+ */
+template <class ItemType>
+bool SimdSearch<ItemType>::hasAvx2()
+{
+    static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+    return supported;
+}
+
+/**
+ * @brief checks (once) whether the CPU supports SSE4.2
+ */
+template <class ItemType>
+bool SimdSearch<ItemType>::hasSse42()
+{
+    static const bool supported = __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt");
+    return supported;
+}
+
+/**
+ * @brief gets the index of the first entry that starts on an alignment boundary
+ *
+ * @param elements to be searched
+ * @param count the number of entries in elements
+ * @param alignment a power of two
+ * @return the lowest index whose address is a multiple of alignment, or count if no entry's is
+ */
+template <class ItemType>
+int SimdSearch<ItemType>::getAlignedStart(const ItemType *elements, int count, std::size_t alignment)
+{
+    std::size_t misalignment = reinterpret_cast<std::uintptr_t>(elements) % alignment;
+    if (misalignment == 0)
+    {
+        return 0;
+    }
+    return static_cast<int>(std::min<std::size_t>((alignment - misalignment) / sizeof(ItemType), count));
+}
+
+/**
+ * @brief fills every lane of a 16 byte register with target
+ *
+ * @param target to be broadcast
+ * @return the register holding 16 / sizeof(ItemType) copies of target
+ */
+template <class ItemType>
+__m128i SimdSearch<ItemType>::broadcast128(const ItemType &target)
+{
+    if constexpr (std::is_same<ItemType, float>::value)
+    {
+        return _mm_castps_si128(_mm_set1_ps(target));
+    }
+    else if constexpr (std::is_same<ItemType, double>::value)
+    {
+        return _mm_castpd_si128(_mm_set1_pd(target));
+    }
+    else if constexpr (sizeof(ItemType) == 1)
+    {
+        return _mm_set1_epi8(static_cast<char>(target));
+    }
+    else if constexpr (sizeof(ItemType) == 2)
+    {
+        return _mm_set1_epi16(static_cast<short>(target));
+    }
+    else if constexpr (sizeof(ItemType) == 4)
+    {
+        return _mm_set1_epi32(static_cast<int>(target));
+    }
+    else
+    {
+        return _mm_set1_epi64x(static_cast<long long>(target));
+    }
+}
+
+/**
+ * @brief fills every lane of a 32 byte register with target
+ *
+ * @param target to be broadcast
+ * @return the register holding 32 / sizeof(ItemType) copies of target
+ */
+template <class ItemType>
+__m256i SimdSearch<ItemType>::broadcast256(const ItemType &target)
+{
+    if constexpr (std::is_same<ItemType, float>::value)
+    {
+        return _mm256_castps_si256(_mm256_set1_ps(target));
+    }
+    else if constexpr (std::is_same<ItemType, double>::value)
+    {
+        return _mm256_castpd_si256(_mm256_set1_pd(target));
+    }
+    else if constexpr (sizeof(ItemType) == 1)
+    {
+        return _mm256_set1_epi8(static_cast<char>(target));
+    }
+    else if constexpr (sizeof(ItemType) == 2)
+    {
+        return _mm256_set1_epi16(static_cast<short>(target));
+    }
+    else if constexpr (sizeof(ItemType) == 4)
+    {
+        return _mm256_set1_epi32(static_cast<int>(target));
+    }
+    else
+    {
+        return _mm256_set1_epi64x(static_cast<long long>(target));
+    }
+}
+
+/**
+ * @brief compares 16 bytes worth of entries against a broadcast target
+ *
+ * @return a byte mask where every byte of a matching entry is set
+ */
+template <class ItemType>
+__m128i SimdSearch<ItemType>::equalMask128(__m128i block, __m128i needle)
+{
+    if constexpr (std::is_same<ItemType, float>::value)
+    {
+        // Floating point compares keep the scalar semantics (NaN != NaN, -0.0 == 0.0)
+        return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(block), _mm_castsi128_ps(needle)));
+    }
+    else if constexpr (std::is_same<ItemType, double>::value)
+    {
+        return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(block), _mm_castsi128_pd(needle)));
+    }
+    else if constexpr (sizeof(ItemType) == 1)
+    {
+        return _mm_cmpeq_epi8(block, needle);
+    }
+    else if constexpr (sizeof(ItemType) == 2)
+    {
+        return _mm_cmpeq_epi16(block, needle);
+    }
+    else if constexpr (sizeof(ItemType) == 4)
+    {
+        return _mm_cmpeq_epi32(block, needle);
+    }
+    else
+    {
+        return _mm_cmpeq_epi64(block, needle);
+    }
+}
+
+/**
+ * @brief compares 32 bytes worth of entries against a broadcast target
+ *
+ * @return a byte mask where every byte of a matching entry is set
+ */
+template <class ItemType>
+__m256i SimdSearch<ItemType>::equalMask256(__m256i block, __m256i needle)
+{
+    if constexpr (std::is_same<ItemType, float>::value)
+    {
+        return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(block), _mm256_castsi256_ps(needle), _CMP_EQ_OQ));
+    }
+    else if constexpr (std::is_same<ItemType, double>::value)
+    {
+        return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(block), _mm256_castsi256_pd(needle), _CMP_EQ_OQ));
+    }
+    else if constexpr (sizeof(ItemType) == 1)
+    {
+        return _mm256_cmpeq_epi8(block, needle);
+    }
+    else if constexpr (sizeof(ItemType) == 2)
+    {
+        return _mm256_cmpeq_epi16(block, needle);
+    }
+    else if constexpr (sizeof(ItemType) == 4)
+    {
+        return _mm256_cmpeq_epi32(block, needle);
+    }
+    else
+    {
+        return _mm256_cmpeq_epi64(block, needle);
+    }
+}
+
+/**
+ * @brief subtracts mask from counters lane by lane, so that every all-ones lane of mask adds one to its counter
+ *
+ * @return the updated counters
+ */
+template <class ItemType>
+__m128i SimdSearch<ItemType>::subtractLanes128(__m128i counters, __m128i mask)
+{
+    if constexpr (sizeof(ItemType) == 1)
+    {
+        return _mm_sub_epi8(counters, mask);
+    }
+    else if constexpr (sizeof(ItemType) == 2)
+    {
+        return _mm_sub_epi16(counters, mask);
+    }
+    else if constexpr (sizeof(ItemType) == 4)
+    {
+        return _mm_sub_epi32(counters, mask);
+    }
+    else
+    {
+        return _mm_sub_epi64(counters, mask);
+    }
+}
+
+/**
+ * @brief subtracts mask from counters lane by lane, so that every all-ones lane of mask adds one to its counter
+ *
+ * @return the updated counters
+ */
+template <class ItemType>
+__m256i SimdSearch<ItemType>::subtractLanes256(__m256i counters, __m256i mask)
+{
+    if constexpr (sizeof(ItemType) == 1)
+    {
+        return _mm256_sub_epi8(counters, mask);
+    }
+    else if constexpr (sizeof(ItemType) == 2)
+    {
+        return _mm256_sub_epi16(counters, mask);
+    }
+    else if constexpr (sizeof(ItemType) == 4)
+    {
+        return _mm256_sub_epi32(counters, mask);
+    }
+    else
+    {
+        return _mm256_sub_epi64(counters, mask);
+    }
+}
+
+/**
+ * @brief adds up the unsigned counters held in every lane
+ *
+ * @return the sum of the counters
+ */
+template <class ItemType>
+long long SimdSearch<ItemType>::sumLanes128(__m128i counters)
+{
+    alignas(16) LaneCounter lanes[16 / sizeof(ItemType)];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), counters);
+    long long sum = 0;
+    for (LaneCounter lane : lanes)
+    {
+        sum += static_cast<long long>(lane);
+    }
+    return sum;
+}
+
+/**
+ * @brief adds up the unsigned counters held in every lane
+ *
+ * @return the sum of the counters
+ */
+template <class ItemType>
+long long SimdSearch<ItemType>::sumLanes256(__m256i counters)
+{
+    alignas(32) LaneCounter lanes[32 / sizeof(ItemType)];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), counters);
+    long long sum = 0;
+    for (LaneCounter lane : lanes)
+    {
+        sum += static_cast<long long>(lane);
+    }
+    return sum;
+}
+
+/**
+ * @brief SSE4.2 version of frequencyOf() - counts 16 bytes of entries per step
+ *
+ * @note every lane keeps its own count, subtracting the all-ones compare mask, and the lanes are only added up once
+ * per COUNTER_LIMIT_ steps - before a narrow lane could wrap around
+ */
+template <class ItemType>
+int SimdSearch<ItemType>::frequencyOfSse42(const ItemType *elements, int count, const ItemType &target)
+{
+    const int lanes = 16 / sizeof(ItemType);
+    __m128i needle = broadcast128(target);
+
+    // Count up to the first 16 byte boundary on its own, so that no load straddles two cache lines
+    int i = getAlignedStart(elements, count, 16);
+    long long frequency = frequencyOfScalar(elements, i, target);
+    while (i + 4 * lanes <= count)
+    {
+        // Four counters keep four independent loads and compares in flight per step
+        int steps = std::min((count - i) / (4 * lanes), COUNTER_LIMIT_);
+        __m128i counters0 = _mm_setzero_si128();
+        __m128i counters1 = _mm_setzero_si128();
+        __m128i counters2 = _mm_setzero_si128();
+        __m128i counters3 = _mm_setzero_si128();
+        for (int step = 0; step < steps; step++, i += 4 * lanes)
+        {
+            const __m128i *blocks = reinterpret_cast<const __m128i *>(elements + i);
+            counters0 = subtractLanes128(counters0, equalMask128(_mm_loadu_si128(blocks), needle));
+            counters1 = subtractLanes128(counters1, equalMask128(_mm_loadu_si128(blocks + 1), needle));
+            counters2 = subtractLanes128(counters2, equalMask128(_mm_loadu_si128(blocks + 2), needle));
+            counters3 = subtractLanes128(counters3, equalMask128(_mm_loadu_si128(blocks + 3), needle));
+        }
+        frequency += sumLanes128(counters0) + sumLanes128(counters1) + sumLanes128(counters2) + sumLanes128(counters3);
+    }
+
+    // At most three whole registers are left, which no counter can overflow on
+    __m128i counters = _mm_setzero_si128();
+    for (; i + lanes <= count; i += lanes)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(elements + i));
+        counters = subtractLanes128(counters, equalMask128(block, needle));
+    }
+    frequency += sumLanes128(counters);
+
+    return static_cast<int>(frequency) + frequencyOfScalar(elements + i, count - i, target);
+}
+
+/**
+ * @brief SSE4.2 version of indexOf() - checks 16 bytes of entries per step
+ */
+template <class ItemType>
+int SimdSearch<ItemType>::indexOfSse42(const ItemType *elements, int count, const ItemType &target)
+{
+    const int lanes = 16 / sizeof(ItemType);
+    __m128i needle = broadcast128(target);
+
+    // Check up to the first 16 byte boundary on its own, so that no load straddles two cache lines
+    int i = getAlignedStart(elements, count, 16);
+    int head_index = indexOfScalar(elements, i, target);
+    if (head_index > -1)
+    {
+        return head_index;
+    }
+    for (; i + lanes <= count; i += lanes)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(elements + i));
+        int mask = _mm_movemask_epi8(equalMask128(block, needle));
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask) / sizeof(ItemType);
+        }
+    }
+
+    int tail_index = indexOfScalar(elements + i, count - i, target);
+    return tail_index > -1 ? i + tail_index : -1;
+}
+
+/**
+ * @brief AVX2 version of frequencyOf() - counts 32 bytes of entries per step
+ *
+ * @note every lane keeps its own count, subtracting the all-ones compare mask, and the lanes are only added up once
+ * per COUNTER_LIMIT_ steps - before a narrow lane could wrap around
+ */
+template <class ItemType>
+int SimdSearch<ItemType>::frequencyOfAvx2(const ItemType *elements, int count, const ItemType &target)
+{
+    const int lanes = 32 / sizeof(ItemType);
+    __m256i needle = broadcast256(target);
+
+    // Count up to the first 32 byte boundary on its own, so that no load straddles two cache lines
+    int i = getAlignedStart(elements, count, 32);
+    long long frequency = frequencyOfScalar(elements, i, target);
+    while (i + 4 * lanes <= count)
+    {
+        // Four counters keep four independent loads and compares in flight per step
+        int steps = std::min((count - i) / (4 * lanes), COUNTER_LIMIT_);
+        __m256i counters0 = _mm256_setzero_si256();
+        __m256i counters1 = _mm256_setzero_si256();
+        __m256i counters2 = _mm256_setzero_si256();
+        __m256i counters3 = _mm256_setzero_si256();
+        for (int step = 0; step < steps; step++, i += 4 * lanes)
+        {
+            const __m256i *blocks = reinterpret_cast<const __m256i *>(elements + i);
+            counters0 = subtractLanes256(counters0, equalMask256(_mm256_loadu_si256(blocks), needle));
+            counters1 = subtractLanes256(counters1, equalMask256(_mm256_loadu_si256(blocks + 1), needle));
+            counters2 = subtractLanes256(counters2, equalMask256(_mm256_loadu_si256(blocks + 2), needle));
+            counters3 = subtractLanes256(counters3, equalMask256(_mm256_loadu_si256(blocks + 3), needle));
+        }
+        frequency += sumLanes256(counters0) + sumLanes256(counters1) + sumLanes256(counters2) + sumLanes256(counters3);
+    }
+
+    // At most three whole registers are left, which no counter can overflow on
+    __m256i counters = _mm256_setzero_si256();
+    for (; i + lanes <= count; i += lanes)
+    {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(elements + i));
+        counters = subtractLanes256(counters, equalMask256(block, needle));
+    }
+    frequency += sumLanes256(counters);
+
+    return static_cast<int>(frequency) + frequencyOfScalar(elements + i, count - i, target);
+}
+
+/**
+ * @brief AVX2 version of indexOf() - checks 32 bytes of entries per step
+ */
+template <class ItemType>
+int SimdSearch<ItemType>::indexOfAvx2(const ItemType *elements, int count, const ItemType &target)
+{
+    const int lanes = 32 / sizeof(ItemType);
+    __m256i needle = broadcast256(target);
+
+    // Check up to the first 32 byte boundary on its own, so that no load straddles two cache lines
+    int i = getAlignedStart(elements, count, 32);
+    int head_index = indexOfScalar(elements, i, target);
+    if (head_index > -1)
+    {
+        return head_index;
+    }
+    for (; i + lanes <= count; i += lanes)
+    {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(elements + i));
+        unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(equalMask256(block, needle)));
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask) / sizeof(ItemType);
+        }
+    }
+
+    int tail_index = indexOfScalar(elements + i, count - i, target);
+    return tail_index > -1 ? i + tail_index : -1;
+}
+
+#endif
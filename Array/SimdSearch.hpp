@@ -0,0 +1,161 @@
+/**
+ * @file SimdSearch.hpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Interface for SimdSearch class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SIMD_SEARCH_
+#define SIMD_SEARCH_
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_SEARCH_X86_
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Vectorized equality search kernels over contiguous arrays
+ *
+ * @note The AVX2 and SSE4.2 kernels are only used for integral, float and double items, and are picked at runtime
+ * based on what the CPU supports. Every other type (and every other CPU) falls back to a plain scalar loop.
+ */
+template <class ItemType>
+class SimdSearch
+{
+public:
+    /**
+     * @brief true if items of this type can be compared by the vectorized kernels
+     */
+    static constexpr bool IS_VECTORIZABLE_ = (std::is_integral<ItemType>::value || std::is_same<ItemType, float>::value || std::is_same<ItemType, double>::value) &&
+                                             (sizeof(ItemType) == 1 || sizeof(ItemType) == 2 || sizeof(ItemType) == 4 || sizeof(ItemType) == 8);
+
+    /**
+     * @brief counts the entries of elements equal to target
+     *
+     * @param elements to be searched
+     * @param count the number of entries in elements
+     * @param target whose instances are to be counted up
+     * @return the number of times target is found
+     */
+    static int frequencyOf(const ItemType *elements, int count, const ItemType &target);
+
+    /**
+     * @brief finds the first entry of elements equal to target
+     *
+     * @param elements to be searched
+     * @param count the number of entries in elements
+     * @param target to be found
+     * @return either the lowest index of target in elements,
+     * @return -1 if elements does not contain the target
+     */
+    static int indexOf(const ItemType *elements, int count, const ItemType &target);
+
+private:
+    /**
+     * @brief scalar fallback used for every type the vectorized kernels cannot handle
+     */
+    static int frequencyOfScalar(const ItemType *elements, int count, const ItemType &target);
+
+    /**
+     * @brief scalar fallback used for every type the vectorized kernels cannot handle
+     */
+    static int indexOfScalar(const ItemType *elements, int count, const ItemType &target);
+
+#ifdef SIMD_SEARCH_X86_
+    // An unsigned integer as wide as one lane, which counts the matches of that lane
+    using LaneCounter = typename std::conditional<sizeof(ItemType) == 1, std::uint8_t,
+                                                  typename std::conditional<sizeof(ItemType) == 2, std::uint16_t,
+                                                                            typename std::conditional<sizeof(ItemType) == 4, std::uint32_t, std::uint64_t>::type>::type>::type;
+
+    // The most steps a lane can count before it could wrap around - 32-bit lanes cannot, since count is an int
+    static constexpr int COUNTER_LIMIT_ = sizeof(ItemType) >= 4 ? INT_MAX : (1 << (8 * sizeof(ItemType))) - 1;
+
+    /**
+     * @brief checks (once) whether the CPU supports AVX2
+     */
+    static bool hasAvx2();
+
+    /**
+     * @brief checks (once) whether the CPU supports SSE4.2
+     */
+    static bool hasSse42();
+
+    /**
+     * @brief gets the index of the first entry that starts on an alignment boundary
+     *
+     * @param elements to be searched
+     * @param count the number of entries in elements
+     * @param alignment a power of two
+     * @return the lowest index whose address is a multiple of alignment, or count if no entry's is
+     */
+    static int getAlignedStart(const ItemType *elements, int count, std::size_t alignment);
+
+    /**
+     * @brief fills every lane of a 16 byte register with target
+     *
+     * @param target to be broadcast
+     * @return the register holding 16 / sizeof(ItemType) copies of target
+     */
+    __attribute__((target("sse4.2"))) static __m128i broadcast128(const ItemType &target);
+
+    /**
+     * @brief fills every lane of a 32 byte register with target
+     *
+     * @param target to be broadcast
+     * @return the register holding 32 / sizeof(ItemType) copies of target
+     */
+    __attribute__((target("avx2"))) static __m256i broadcast256(const ItemType &target);
+
+    /**
+     * @brief compares 16 bytes worth of entries against a broadcast target
+     *
+     * @return a byte mask where every byte of a matching entry is set
+     */
+    __attribute__((target("sse4.2"))) static __m128i equalMask128(__m128i block, __m128i needle);
+
+    /**
+     * @brief compares 32 bytes worth of entries against a broadcast target
+     *
+     * @return a byte mask where every byte of a matching entry is set
+     */
+    __attribute__((target("avx2"))) static __m256i equalMask256(__m256i block, __m256i needle);
+
+    /**
+     * @brief subtracts mask from counters lane by lane, so that every all-ones lane of mask adds one to its counter
+     */
+    __attribute__((target("sse4.2"))) static __m128i subtractLanes128(__m128i counters, __m128i mask);
+
+    /**
+     * @brief subtracts mask from counters lane by lane, so that every all-ones lane of mask adds one to its counter
+     */
+    __attribute__((target("avx2"))) static __m256i subtractLanes256(__m256i counters, __m256i mask);
+
+    /**
+     * @brief adds up the unsigned counters held in every lane
+     */
+    __attribute__((target("sse4.2"))) static long long sumLanes128(__m128i counters);
+
+    /**
+     * @brief adds up the unsigned counters held in every lane
+     */
+    __attribute__((target("avx2"))) static long long sumLanes256(__m256i counters);
+
+    __attribute__((target("sse4.2"))) static int frequencyOfSse42(const ItemType *elements, int count, const ItemType &target);
+    __attribute__((target("sse4.2,popcnt"))) static int indexOfSse42(const ItemType *elements, int count, const ItemType &target);
+    __attribute__((target("avx2"))) static int frequencyOfAvx2(const ItemType *elements, int count, const ItemType &target);
+    __attribute__((target("avx2,popcnt"))) static int indexOfAvx2(const ItemType *elements, int count, const ItemType &target);
+#endif
+};
+
+#include "SimdSearch.cpp"
+#endif
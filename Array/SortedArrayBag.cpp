@@ -0,0 +1,403 @@
+/**
+ * @file SortedArrayBag.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Implementation for SortedArrayBag class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "SortedArrayBag.hpp"
+
+/**
+ * @brief default constructor
+ */
+template <class ItemType, int InlineCapacity>
+SortedArrayBag<ItemType, InlineCapacity>::SortedArrayBag() : ArrayBag<ItemType, InlineCapacity>(), sorted_{true}
+{
+}
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param array_size whose value will determine the capacity of the array size at instantiation time
+ * @param memory_resource to allocate every heap buffer from
+ */
+template <class ItemType, int InlineCapacity>
+SortedArrayBag<ItemType, InlineCapacity>::SortedArrayBag(const int &array_size, std::pmr::memory_resource *memory_resource) : ArrayBag<ItemType, InlineCapacity>(array_size, memory_resource), sorted_{true}
+{
+}
+
+/**
+ * @brief gets the frequency of an object in O(log n), sorting the bag first if it is unsorted
+ *
+ * @param an_entry whose intances in elements_ are to be counted up
+ * @return the number of times an_entry is found
+ */
+template <class ItemType, int InlineCapacity>
+int SortedArrayBag<ItemType, InlineCapacity>::getFrequencyOf(const ItemType &an_entry)
+{
+    sort();
+    return static_cast<const SortedArrayBag<ItemType, InlineCapacity> &>(*this).getFrequencyOf(an_entry);
+}
+
+/**
+ * @brief gets the frequency of an object, without modifying the bag
+ *
+ * @param an_entry whose intances in elements_ are to be counted up
+ * @note takes O(log n) if the bag is sorted, and a linear scan otherwise
+ * @return the number of times an_entry is found
+ */
+template <class ItemType, int InlineCapacity>
+int SortedArrayBag<ItemType, InlineCapacity>::getFrequencyOf(const ItemType &an_entry) const
+{
+    if (!sorted_)
+    {
+        return ArrayBag<ItemType, InlineCapacity>::getFrequencyOf(an_entry);
+    }
+    auto range = std::equal_range(this->elements_, this->elements_ + this->item_count_, an_entry);
+    return static_cast<int>(range.second - range.first);
+}
+
+/**
+ * @brief locates an_entry in O(log n), sorting the bag first if it is unsorted
+ *
+ * @param an_entry to be located in elements_
+ * @return true if an_entry is found in elements_,
+ * @return false otherwise
+ */
+template <class ItemType, int InlineCapacity>
+bool SortedArrayBag<ItemType, InlineCapacity>::contains(const ItemType &an_entry)
+{
+    sort();
+    return getIndexOf(an_entry) > -1;
+}
+
+/**
+ * @brief locates an_entry, without modifying the bag
+ *
+ * @param an_entry to be located in elements_
+ * @note takes O(log n) if the bag is sorted, and a linear scan otherwise
+ * @return true if an_entry is found in elements_,
+ * @return false otherwise
+ */
+template <class ItemType, int InlineCapacity>
+bool SortedArrayBag<ItemType, InlineCapacity>::contains(const ItemType &an_entry) const
+{
+    return getIndexOf(an_entry) > -1;
+}
+
+/**
+ * @brief adds new_entry at the end of elements_
+ *
+ * @param new_entry to insert into elements_
+ * @return true as long as there is available RAM on the system since the array's size can increase
+ */
+template <class ItemType, int InlineCapacity>
+bool SortedArrayBag<ItemType, InlineCapacity>::push_back(const ItemType &new_entry)
+{
+    emplace_back(new_entry);
+    return true;
+}
+
+/**
+ * @brief moves new_entry to the end of elements_
+ *
+ * @param new_entry to be moved to the back of elements_
+ * @return true as long as there is available RAM on the system since the array's size can increase
+ */
+template <class ItemType, int InlineCapacity>
+bool SortedArrayBag<ItemType, InlineCapacity>::push_back(ItemType &&new_entry)
+{
+    emplace_back(std::move(new_entry));
+    return true;
+}
+
+/**
+ * @brief constructs a new entry in place at the back of elements_
+ *
+ * @param args to be forwarded to the constructor of ItemType
+ * @return a read-only reference to the new entry
+ */
+template <class ItemType, int InlineCapacity>
+template <class... Args>
+const ItemType &SortedArrayBag<ItemType, InlineCapacity>::emplace_back(Args &&...args)
+{
+    const ItemType &new_entry = ArrayBag<ItemType, InlineCapacity>::emplace_back(std::forward<Args>(args)...);
+    checkLastEntry();
+    return new_entry;
+}
+
+/**
+ * @brief adds new_entry at its sorted position, shifting every greater entry right by one
+ *
+ * @param new_entry to insert into elements_
+ * @return true as long as there is available RAM on the system since the array's size can increase
+ */
+template <class ItemType, int InlineCapacity>
+bool SortedArrayBag<ItemType, InlineCapacity>::insert(const ItemType &new_entry)
+{
+    sort();
+
+    // Append first so that growing (and new_entry possibly living in the old buffer) is handled in one place
+    ArrayBag<ItemType, InlineCapacity>::emplace_back(new_entry);
+    ItemType *last = this->elements_ + this->item_count_ - 1;
+    ItemType *position = std::upper_bound(this->elements_, last, *last);
+    std::rotate(position, last, last + 1);
+    return true;
+}
+
+/**
+ * @brief appends a batch of entries and merges it into the sorted entries in O(n + k)
+ *
+ * @param first iterator to the first entry of the batch
+ * @param last iterator past the last entry of the batch
+ * @note a batch that is not already sorted is sorted on its own first
+ */
+template <class ItemType, int InlineCapacity>
+template <class InputIterator>
+void SortedArrayBag<ItemType, InlineCapacity>::mergeSorted(InputIterator first, InputIterator last)
+{
+    using Category = typename std::iterator_traits<InputIterator>::iterator_category;
+    if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value)
+    {
+        this->reserve(this->item_count_ + static_cast<int>(std::distance(first, last)));
+    }
+
+    // Mark the bag unsorted until the batch is merged in, in case an append, the sort or the merge throws
+    bool was_sorted = sorted_;
+    sorted_ = false;
+
+    int middle = this->item_count_;
+    for (; first != last; ++first)
+    {
+        ArrayBag<ItemType, InlineCapacity>::emplace_back(*first);
+    }
+
+    ItemType *batch = this->elements_ + middle;
+    ItemType *end = this->elements_ + this->item_count_;
+    if (!std::is_sorted(batch, end))
+    {
+        std::sort(batch, end);
+    }
+
+    // An unsorted bag is left for the next query to sort as a whole
+    if (was_sorted)
+    {
+        std::inplace_merge(this->elements_, batch, end);
+        sorted_ = true;
+    }
+}
+
+/**
+ * @brief finds and removes an_entry from elements_
+ *
+ * @param an_entry to be removed
+ * @post if the bag is ordered, every later entry is shifted left by one and the bag stays sorted, otherwise the
+ * last entry fills the hole and the bag is sorted again on the next query
+ * @return true if an_entry was successfully removed from elements_,
+ * @return false otherwise
+ */
+template <class ItemType, int InlineCapacity>
+bool SortedArrayBag<ItemType, InlineCapacity>::removeInstanceOf(const ItemType &an_entry)
+{
+    sort();
+    int move_index = getIndexOf(an_entry);
+    if (move_index < 0)
+    {
+        return false;
+    }
+
+    this->detach();
+    int last_index = this->item_count_ - 1;
+    if (!this->ordered_)
+    {
+        if (move_index != last_index)
+        {
+            this->elements_[move_index] = std::move(this->elements_[last_index]);
+            sorted_ = false;
+        }
+    }
+    else
+    {
+        std::move(this->elements_ + move_index + 1, this->elements_ + this->item_count_, this->elements_ + move_index);
+    }
+
+    this->item_count_--;
+    this->elements_[this->item_count_].~ItemType();
+    return true;
+}
+
+/**
+ * @brief removes every instance of an_entry from elements_ in a single pass
+ *
+ * @param an_entry to be removed
+ * @note the instances are found in O(log n), and the entries after them are shifted left in one move
+ * @return the number of entries removed
+ */
+template <class ItemType, int InlineCapacity>
+int SortedArrayBag<ItemType, InlineCapacity>::removeAllInstancesOf(const ItemType &an_entry)
+{
+    sort();
+    auto range = std::equal_range(this->elements_, this->elements_ + this->item_count_, an_entry);
+    int first_index = static_cast<int>(range.first - this->elements_);
+    int removed = static_cast<int>(range.second - range.first);
+    if (removed == 0)
+    {
+        return 0;
+    }
+
+    // Removing a contiguous run of equal entries keeps the rest sorted, whether or not the bag is ordered
+    this->detach();
+    ItemType *elements = this->elements_;
+    ItemType *new_end = std::move(elements + first_index + removed, elements + this->item_count_, elements + first_index);
+    for (ItemType *entry = new_end; entry != elements + this->item_count_; entry++)
+    {
+        entry->~ItemType();
+    }
+    this->item_count_ -= removed;
+    return removed;
+}
+
+/**
+ * @brief removes every entry for which predicate returns true in a single pass
+ *
+ * @param predicate to be called once on each entry
+ * @post if the bag is ordered, the remaining entries keep their relative order
+ * @return the number of entries removed
+ */
+template <class ItemType, int InlineCapacity>
+template <class Predicate>
+int SortedArrayBag<ItemType, InlineCapacity>::remove_if(Predicate predicate)
+{
+    int removed = ArrayBag<ItemType, InlineCapacity>::remove_if(predicate);
+    if (removed > 0 && !this->ordered_)
+    {
+        sorted_ = false;
+    }
+    return removed;
+}
+
+/**
+ * @brief makes the array empty
+ *
+ * @post every entry is destroyed, and the empty bag is sorted
+ */
+template <class ItemType, int InlineCapacity>
+void SortedArrayBag<ItemType, InlineCapacity>::clear()
+{
+    ArrayBag<ItemType, InlineCapacity>::clear();
+    sorted_ = true;
+}
+
+/**
+ * @brief sorts the entries now, if they are not sorted already
+ */
+template <class ItemType, int InlineCapacity>
+void SortedArrayBag<ItemType, InlineCapacity>::sort()
+{
+    if (!sorted_)
+    {
+        // Sorting moves entries around, so make sure no snapshot sees it
+        this->detach();
+        std::sort(this->elements_, this->elements_ + this->item_count_);
+        sorted_ = true;
+    }
+}
+
+/**
+ * @brief checks if the entries are currently sorted
+ *
+ * @return true if the entries are sorted,
+ * @return false if they will be sorted on the next query through a non-const bag
+ */
+template <class ItemType, int InlineCapacity>
+bool SortedArrayBag<ItemType, InlineCapacity>::isSorted() const
+{
+    return sorted_;
+}
+
+/**
+ * @brief Allows direct element access using the [] operator
+ *
+ * @param i is the index in the array
+ * @note Bounds-checking is NOT performed -> Be sure to avoid using indexes greater than or equal to item_count_
+ * @note the bag is not sorted first - call sort() to read the entries in order
+ * @return a read-only reference to the item at the location specified by the parameter
+ */
+template <class ItemType, int InlineCapacity>
+const ItemType &SortedArrayBag<ItemType, InlineCapacity>::operator[](int i) const
+{
+    return this->elements_[i];
+}
+
+/**
+ * @brief gets a read-only iterator to the first entry
+ *
+ * @note only read-only iteration is offered - writing through it could break the order
+ * @return a pointer to the first entry of elements_
+ */
+template <class ItemType, int InlineCapacity>
+typename SortedArrayBag<ItemType, InlineCapacity>::const_iterator SortedArrayBag<ItemType, InlineCapacity>::begin() const
+{
+    return ArrayBag<ItemType, InlineCapacity>::begin();
+}
+
+/**
+ * @brief gets a read-only iterator past the last entry
+ *
+ * @return a pointer past the last entry of elements_
+ */
+template <class ItemType, int InlineCapacity>
+typename SortedArrayBag<ItemType, InlineCapacity>::const_iterator SortedArrayBag<ItemType, InlineCapacity>::end() const
+{
+    return ArrayBag<ItemType, InlineCapacity>::end();
+}
+
+/**
+ * @brief gets read-only access to the underlying array
+ *
+ * @return a pointer to elements_, valid until the bag next grows or shrinks
+ */
+template <class ItemType, int InlineCapacity>
+const ItemType *SortedArrayBag<ItemType, InlineCapacity>::data() const
+{
+    return this->elements_;
+}
+
+//********* PRIVATE METHODS **************//
+
+/**
+ * @brief Get the index of target in elements_
+ *
+ * @param target to be found in elements_
+ * @note searches in O(log n) if the bag is sorted, and scans linearly otherwise
+ * @return either the lowest index of target in elements_,
+ * @return -1 if elements_ does not contain the target
+ */
+template <class ItemType, int InlineCapacity>
+int SortedArrayBag<ItemType, InlineCapacity>::getIndexOf(const ItemType &target) const
+{
+    if (!sorted_)
+    {
+        return ArrayBag<ItemType, InlineCapacity>::getIndexOf(target);
+    }
+    ItemType *end = this->elements_ + this->item_count_;
+    ItemType *found = std::lower_bound(this->elements_, end, target);
+    return (found != end && !(target < *found)) ? static_cast<int>(found - this->elements_) : -1;
+}
+
+/**
+ * @brief clears sorted_ if the last entry is less than the one before it
+ */
+template <class ItemType, int InlineCapacity>
+void SortedArrayBag<ItemType, InlineCapacity>::checkLastEntry()
+{
+    int last_index = this->item_count_ - 1;
+    if (sorted_ && last_index > 0 && this->elements_[last_index] < this->elements_[last_index - 1])
+    {
+        sorted_ = false;
+    }
+}
@@ -0,0 +1,252 @@
+/**
+ * @file SortedArrayBag.hpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Interface for SortedArrayBag class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SORTED_ARRAY_BAG_
+#define SORTED_ARRAY_BAG_
+
+#include <algorithm>
+#include <iterator>
+#include "ArrayBag.hpp"
+
+/**
+ * @brief An ArrayBag that keeps its entries sorted, so that getFrequencyOf() and contains() are answered with a binary
+ * search in O(log n) instead of a linear scan
+ *
+ * @note ItemType must be comparable with operator<
+ * @note Appending out of order only marks the bag unsorted - it is sorted once, lazily, on the next query through a
+ * non-const bag. Appending in order (or with insert() or mergeSorted()) keeps it sorted
+ * @note Queries through a const bag never modify it, so const readers may share it between threads - but they scan
+ * linearly while the bag is unsorted, so call sort() before handing a freshly modified bag to them
+ * @note Entries can only be read through operator[] - writing through a reference could break the order
+ * @note The ArrayBag is inherited privately, so the bag cannot be appended to through an ArrayBag reference without
+ * sorted_ being updated - only the operations that keep it up to date are offered
+ */
+template <class ItemType, int InlineCapacity = 0>
+class SortedArrayBag : private ArrayBag<ItemType, InlineCapacity>
+{
+public:
+    using typename ArrayBag<ItemType, InlineCapacity>::value_type;
+    using typename ArrayBag<ItemType, InlineCapacity>::size_type;
+    using typename ArrayBag<ItemType, InlineCapacity>::const_reference;
+    using typename ArrayBag<ItemType, InlineCapacity>::const_iterator;
+
+    // Operations that cannot break the order - removing the last entry leaves the rest sorted
+    using ArrayBag<ItemType, InlineCapacity>::getCurrentSize;
+    using ArrayBag<ItemType, InlineCapacity>::getCurrentCapacity;
+    using ArrayBag<ItemType, InlineCapacity>::isEmpty;
+    using ArrayBag<ItemType, InlineCapacity>::pop_back;
+    using ArrayBag<ItemType, InlineCapacity>::reserve;
+    using ArrayBag<ItemType, InlineCapacity>::shrink_to_fit;
+    using ArrayBag<ItemType, InlineCapacity>::cbegin;
+    using ArrayBag<ItemType, InlineCapacity>::cend;
+    using ArrayBag<ItemType, InlineCapacity>::setOrdered;
+    using ArrayBag<ItemType, InlineCapacity>::isOrdered;
+    using ArrayBag<ItemType, InlineCapacity>::snapshot;
+    using ArrayBag<ItemType, InlineCapacity>::isShared;
+    using ArrayBag<ItemType, InlineCapacity>::isInline;
+    using ArrayBag<ItemType, InlineCapacity>::getMemoryResource;
+
+    /**
+     * @brief default constructor
+     */
+    SortedArrayBag();
+
+    /**
+     * @brief parameterized constructor
+     *
+     * @param array_size whose value will determine the capacity of the array size at instantiation time
+     * @param memory_resource to allocate every heap buffer from
+     */
+    SortedArrayBag(const int &array_size, std::pmr::memory_resource *memory_resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief gets the frequency of an object, sorting the bag first if it is unsorted
+     *
+     * @param an_entry whose intances in elements_ are to be counted up
+     * @return the number of times an_entry is found
+     */
+    int getFrequencyOf(const ItemType &an_entry);
+
+    /**
+     * @brief gets the frequency of an object, without modifying the bag
+     *
+     * @param an_entry whose intances in elements_ are to be counted up
+     * @return the number of times an_entry is found
+     */
+    int getFrequencyOf(const ItemType &an_entry) const;
+
+    /**
+     * @brief locates an_entry, sorting the bag first if it is unsorted
+     *
+     * @param an_entry to be located in elements_
+     * @return true if an_entry is found in elements_,
+     * @return false otherwise
+     */
+    bool contains(const ItemType &an_entry);
+
+    /**
+     * @brief locates an_entry, without modifying the bag
+     *
+     * @param an_entry to be located in elements_
+     * @return true if an_entry is found in elements_,
+     * @return false otherwise
+     */
+    bool contains(const ItemType &an_entry) const;
+
+    /**
+     * @brief adds new_entry at the end of elements_
+     *
+     * @param new_entry to insert into elements_
+     * @return true if new_entry was successfully added to elements_,
+     * @return false otherwise
+     */
+    bool push_back(const ItemType &new_entry);
+
+    /**
+     * @brief moves new_entry to the end of elements_
+     *
+     * @param new_entry to be moved to the back of elements_
+     * @return true if new_entry was successfully added to elements_,
+     * @return false otherwise
+     */
+    bool push_back(ItemType &&new_entry);
+
+    /**
+     * @brief constructs a new entry in place at the back of elements_
+     *
+     * @param args to be forwarded to the constructor of ItemType
+     * @return a read-only reference to the new entry
+     */
+    template <class... Args>
+    const ItemType &emplace_back(Args &&...args);
+
+    /**
+     * @brief adds new_entry at its sorted position, shifting every greater entry right by one
+     *
+     * @param new_entry to insert into elements_
+     * @return true if new_entry was successfully added to elements_,
+     * @return false otherwise
+     */
+    bool insert(const ItemType &new_entry);
+
+    /**
+     * @brief appends a batch of entries and merges it into the sorted entries in O(n + k)
+     *
+     * @param first iterator to the first entry of the batch
+     * @param last iterator past the last entry of the batch
+     * @note a batch that is not already sorted is sorted on its own first
+     */
+    template <class InputIterator>
+    void mergeSorted(InputIterator first, InputIterator last);
+
+    /**
+     * @brief finds and removes an_entry from elements_
+     *
+     * @param an_entry to be removed
+     * @post if the bag is ordered, every later entry is shifted left by one and the bag stays sorted, otherwise the
+     * last entry fills the hole and the bag is sorted again on the next query
+     * @return true if an_entry was successfully removed from elements_,
+     * @return false otherwise
+     */
+    bool removeInstanceOf(const ItemType &an_entry);
+
+    /**
+     * @brief removes every instance of an_entry from elements_ in a single pass
+     *
+     * @param an_entry to be removed
+     * @return the number of entries removed
+     */
+    int removeAllInstancesOf(const ItemType &an_entry);
+
+    /**
+     * @brief removes every entry for which predicate returns true in a single pass
+     *
+     * @param predicate to be called once on each entry
+     * @post if the bag is ordered, the remaining entries keep their relative order
+     * @return the number of entries removed
+     */
+    template <class Predicate>
+    int remove_if(Predicate predicate);
+
+    /**
+     * @brief makes the array empty
+     *
+     * @post every entry is destroyed, and the empty bag is sorted
+     */
+    void clear();
+
+    /**
+     * @brief sorts the entries now, if they are not sorted already
+     */
+    void sort();
+
+    /**
+     * @brief checks if the entries are currently sorted
+     *
+     * @return true if the entries are sorted,
+     * @return false if they will be sorted on the next query through a non-const bag
+     */
+    bool isSorted() const;
+
+    /**
+     * @brief Allows direct element access using the [] operator
+     *
+     * @param i is the index in the array
+     * @note Bounds-checking is NOT performed -> Be sure to avoid using indexes greater than or equal to item_count_
+     * @note the bag is not sorted first - call sort() to read the entries in order
+     * @return a read-only reference to the item at the location specified by the parameter
+     */
+    const ItemType &operator[](int i) const;
+
+    /**
+     * @brief gets a read-only iterator to the first entry
+     *
+     * @note only read-only iteration is offered - writing through it could break the order
+     * @return a pointer to the first entry of elements_
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief gets a read-only iterator past the last entry
+     *
+     * @return a pointer past the last entry of elements_
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief gets read-only access to the underlying array
+     *
+     * @return a pointer to elements_, valid until the bag next grows or shrinks
+     */
+    const ItemType *data() const;
+
+protected:
+    // Cleared by any append that breaks the order, and set again by the next sort
+    bool sorted_;
+
+    /**
+     * @brief Get the index of target in elements_
+     *
+     * @param target to be found in elements_
+     * @note searches in O(log n) if the bag is sorted, and scans linearly otherwise
+     * @return either the lowest index of target in elements_,
+     * @return -1 if elements_ does not contain the target
+     */
+    int getIndexOf(const ItemType &target) const;
+
+    /**
+     * @brief clears sorted_ if the last entry is less than the one before it
+     */
+    void checkLastEntry();
+};
+
+#include "SortedArrayBag.cpp"
+#endif
@@ -41,8 +41,8 @@ BinaryNode<ItemType>::BinaryNode(const ItemType &an_item) : item_{an_item},
  */
 template <class ItemType>
 BinaryNode<ItemType>::BinaryNode(const ItemType &an_item, std::shared_ptr<BinaryNode<ItemType>> left_ptr, std::shared_ptr<BinaryNode<ItemType>> right_ptr) : item_{an_item},
-                                                                                                                                                             left_child_ptr_{left_child_ptr_},
-                                                                                                                                                             right_child_ptr_{right_child_ptr_}
+                                                                                                                                                             left_child_ptr_{left_ptr},
+                                                                                                                                                             right_child_ptr_{right_ptr}
 {
 }
 
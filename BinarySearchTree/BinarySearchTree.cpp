@@ -16,7 +16,19 @@
  *
  */
 template <class ItemType>
-BinarySearchTree<ItemType>::BinarySearchTree() : root_ptr_{std::shared_ptr<BinaryNode<ItemType>>(nullptr)}
+BinarySearchTree<ItemType>::BinarySearchTree() : root_ptr_{std::shared_ptr<BinaryNode<ItemType>>(nullptr)},
+                                                 memory_resource_{std::pmr::get_default_resource()}
+{
+}
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param memory_resource to allocate every node from
+ */
+template <class ItemType>
+BinarySearchTree<ItemType>::BinarySearchTree(std::pmr::memory_resource *memory_resource) : root_ptr_{std::shared_ptr<BinaryNode<ItemType>>(nullptr)},
+                                                                                          memory_resource_{memory_resource}
 {
 }
 
@@ -24,19 +36,22 @@ BinarySearchTree<ItemType>::BinarySearchTree() : root_ptr_{std::shared_ptr<Binar
  * @brief parameterized constructor
  *
  * @param root_item to be inserted at root of tree
+ * @param memory_resource to allocate every node from
  */
 template <class ItemType>
-BinarySearchTree<ItemType>::BinarySearchTree(const ItemType &root_item) : root_ptr_{std::make_shared<BinaryNode<ItemType>>(root_item, std::shared_ptr<BinaryNode<ItemType>>(nullptr), std::shared_ptr<BinaryNode<ItemType>>(nullptr))}
+BinarySearchTree<ItemType>::BinarySearchTree(const ItemType &root_item, std::pmr::memory_resource *memory_resource) : memory_resource_{memory_resource}
 {
+    root_ptr_ = makeNode(root_item);
 }
 
 /**
  * @brief copy constructor
  *
  * @param another_tree to be copied into the new tree
+ * @note the copy allocates its nodes from the same memory resource as another_tree
  */
 template <class ItemType>
-BinarySearchTree<ItemType>::BinarySearchTree(const BinarySearchTree &another_tree)
+BinarySearchTree<ItemType>::BinarySearchTree(const BinarySearchTree &another_tree) : memory_resource_{another_tree.memory_resource_}
 {
     root_ptr_ = copyTree(another_tree.root_ptr_);
 }
@@ -46,9 +61,11 @@ BinarySearchTree<ItemType>::BinarySearchTree(const BinarySearchTree &another_tre
  *
  * @note these objects MUST have the >, ==, and < operators overloaded in order for this function to work
  * @param nums a sorted vector containing objects of an arbitrary type with overloaded comparison operators
+ * @param memory_resource to allocate every node from
  */
 template <class ItemType>
-BinarySearchTree<ItemType>::BinarySearchTree(std::vector<ItemType> &items) : root_ptr_{nullptr}
+BinarySearchTree<ItemType>::BinarySearchTree(std::vector<ItemType> &items, std::pmr::memory_resource *memory_resource) : root_ptr_{nullptr},
+                                                                                                                        memory_resource_{memory_resource}
 {
     int size = items.size();
     for (int i = 0; i < size; i++)
@@ -112,7 +129,7 @@ int BinarySearchTree<ItemType>::getNumberOfNodes() const
 template <class ItemType>
 void BinarySearchTree<ItemType>::add(const ItemType &an_entry)
 {
-    std::shared_ptr<BinaryNode<ItemType>> new_node_ptr = std::make_shared<BinaryNode<ItemType>>(an_entry);
+    std::shared_ptr<BinaryNode<ItemType>> new_node_ptr = makeNode(an_entry);
     root_ptr_ = placeNode(root_ptr_, new_node_ptr);
 }
 
@@ -149,12 +166,40 @@ bool BinarySearchTree<ItemType>::contains(const ItemType &an_entry)
 /**
  * @brief displays the preorder traversal through the Binary Search Tree
  *
+ * @note the items are written in large blocks, and std::cout is flushed once at the end
  */
 template <class ItemType>
 void BinarySearchTree<ItemType>::displayPreorder()
 {
-    preorderHelper(root_ptr_);
-    std::cout << std::endl;
+    displayPreorder(std::cout);
+    std::cout.flush();
+}
+
+/**
+ * @brief writes the preorder traversal through the Binary Search Tree to a stream, each item followed by a space,
+ * and then a newline
+ *
+ * @param out the stream to write to - it is written in large blocks and never flushed
+ */
+template <class ItemType>
+void BinarySearchTree<ItemType>::displayPreorder(std::ostream &out) const
+{
+    BufferedWriter writer(out);
+    displayPreorder(writer);
+    writer.flush();
+}
+
+/**
+ * @brief writes the preorder traversal through the Binary Search Tree into a writer, each item followed by a space,
+ * and then a newline
+ *
+ * @param writer to write to - nothing reaches its sink until it fills up or is flushed
+ */
+template <class ItemType>
+void BinarySearchTree<ItemType>::displayPreorder(BufferedWriter &writer) const
+{
+    preorderHelper(root_ptr_, writer);
+    writer.put('\n');
 }
 
 // /**
@@ -187,6 +232,17 @@ bool BinarySearchTree<ItemType>::isBalanced()
     }
 }
 
+/**
+ * @brief gets the memory resource the tree allocates its nodes from
+ *
+ * @return a pointer to the memory resource
+ */
+template <class ItemType>
+std::pmr::memory_resource *BinarySearchTree<ItemType>::getMemoryResource() const
+{
+    return memory_resource_;
+}
+
 // /**
 //  * @brief checks if the tree is a complete Binary Search Tree
 //  *
@@ -208,20 +264,34 @@ bool BinarySearchTree<ItemType>::isBalanced()
 //-----Private Methods------
 
 /**
- * @brief recursively prints the contents of the subtree pointed to by the node pointer
+ * @brief allocates a new leaf node (and its control block) from memory_resource_
+ *
+ * @param an_item to be held by the node
+ * @return a pointer to the new node
+ */
+template <class ItemType>
+std::shared_ptr<BinaryNode<ItemType>> BinarySearchTree<ItemType>::makeNode(const ItemType &an_item) const
+{
+    return std::allocate_shared<BinaryNode<ItemType>>(std::pmr::polymorphic_allocator<BinaryNode<ItemType>>(memory_resource_), an_item);
+}
+
+/**
+ * @brief recursively writes the contents of the subtree pointed to by the node pointer
  *
  * @param node that points to the root node in a subtree
+ * @param writer to write to
  */
 template <class ItemType>
-void BinarySearchTree<ItemType>::preorderHelper(std::shared_ptr<BinaryNode<ItemType>> node)
+void BinarySearchTree<ItemType>::preorderHelper(const std::shared_ptr<BinaryNode<ItemType>> &node, BufferedWriter &writer) const
 {
     if (node == std::shared_ptr<BinaryNode<ItemType>>(nullptr))
     {
         return;
     }
-    std::cout << node->getItem() << " ";
-    preorderHelper(node->getLeftChildPtr());
-    preorderHelper(node->getRightChildPtr());
+    writer.write(node->getItem());
+    writer.put(' ');
+    preorderHelper(node->getLeftChildPtr(), writer);
+    preorderHelper(node->getRightChildPtr(), writer);
 }
 
 /**
@@ -239,10 +309,11 @@ std::shared_ptr<BinaryNode<ItemType>> BinarySearchTree<ItemType>::copyTree(const
     if (old_tree_root_ptr != std::shared_ptr<BinaryNode<ItemType>>(nullptr))
     {
         // Copy node
-        new_tree_ptr = std::make_shared<BinaryNode<ItemType>>(old_tree_root_ptr->getItem(), std::shared_ptr<BinaryNode<ItemType>>(nullptr), std::shared_ptr<BinaryNode<ItemType>>(nullptr));
+        new_tree_ptr = makeNode(old_tree_root_ptr->getItem());
         new_tree_ptr->setLeftChildPtr(copyTree(old_tree_root_ptr->getLeftChildPtr()));
         new_tree_ptr->setRightChildPtr(copyTree(old_tree_root_ptr->getRightChildPtr()));
     }
+    return new_tree_ptr;
 }
 
 /**
@@ -279,7 +350,7 @@ int BinarySearchTree<ItemType>::getNumberOfNodesHelper(std::shared_ptr<BinaryNod
     }
     else
     {
-        return 1 + getNumberOfNodesHelper(subtree_ptr->getLeftChildPtr()) + getNumberOfNodesHelper(subtree_ptr->GetRightChildPtr());
+        return 1 + getNumberOfNodesHelper(subtree_ptr->getLeftChildPtr()) + getNumberOfNodesHelper(subtree_ptr->getRightChildPtr());
     }
 }
 
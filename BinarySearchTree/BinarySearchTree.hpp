@@ -14,9 +14,11 @@
 
 #include "../BinaryNode/BinaryNode.hpp"
 #include <memory>
+#include <memory_resource>
 #include <vector>
 #include <cstdlib>
 #include <iostream>
+#include "../Output/BufferedWriter.hpp"
 
 template <class ItemType>
 class BinarySearchTree
@@ -28,17 +30,26 @@ public:
      */
     BinarySearchTree();
 
+    /**
+     * @brief parameterized constructor
+     *
+     * @param memory_resource to allocate every node from
+     */
+    explicit BinarySearchTree(std::pmr::memory_resource *memory_resource);
+
     /**
      * @brief parameterized constructor
      *
      * @param root_item to be inserted at root of tree
+     * @param memory_resource to allocate every node from
      */
-    BinarySearchTree(const ItemType &root_item);
+    BinarySearchTree(const ItemType &root_item, std::pmr::memory_resource *memory_resource = std::pmr::get_default_resource());
 
     /**
      * @brief copy constructor
      *
      * @param another_tree to be copied into the new tree
+     * @note the copy allocates its nodes from the same memory resource as another_tree
      */
     BinarySearchTree(const BinarySearchTree &another_tree);
 
@@ -47,8 +58,9 @@ public:
      *
      * @note these objects MUST have the >, ==, and < operators overloaded in order for this function to work
      * @param nums a sorted vector containing objects of an arbitrary type with overloaded comparison operators
+     * @param memory_resource to allocate every node from
      */
-    BinarySearchTree(std::vector<ItemType> &items);
+    BinarySearchTree(std::vector<ItemType> &items, std::pmr::memory_resource *memory_resource = std::pmr::get_default_resource());
 
     /**
      * @brief returns the pointer to the root of the tree
@@ -111,9 +123,26 @@ public:
     /**
      * @brief displays the preorder traversal through the Binary Search Tree
      *
+     * @note the items are written in large blocks, and std::cout is flushed once at the end
      */
     void displayPreorder();
 
+    /**
+     * @brief writes the preorder traversal through the Binary Search Tree to a stream, each item followed by a space,
+     * and then a newline
+     *
+     * @param out the stream to write to - it is written in large blocks and never flushed
+     */
+    void displayPreorder(std::ostream &out) const;
+
+    /**
+     * @brief writes the preorder traversal through the Binary Search Tree into a writer, each item followed by a space,
+     * and then a newline
+     *
+     * @param writer to write to - nothing reaches its sink until it fills up or is flushed
+     */
+    void displayPreorder(BufferedWriter &writer) const;
+
     // /**
     //  * @brief rearranges the tree to be in-order, so that the leftmost node in the tree is now the root of the tree and every node has no left child and only one right child
     //  *
@@ -128,6 +157,13 @@ public:
      */
     bool isBalanced();
 
+    /**
+     * @brief gets the memory resource the tree allocates its nodes from
+     *
+     * @return a pointer to the memory resource
+     */
+    std::pmr::memory_resource *getMemoryResource() const;
+
     // /**
     //  * @brief checks if the tree is a complete Binary Search Tree
     //  *
@@ -146,13 +182,23 @@ public:
 
 private:
     std::shared_ptr<BinaryNode<ItemType>> root_ptr_;
+    std::pmr::memory_resource *memory_resource_;
+
+    /**
+     * @brief allocates a new leaf node (and its control block) from memory_resource_
+     *
+     * @param an_item to be held by the node
+     * @return a pointer to the new node
+     */
+    std::shared_ptr<BinaryNode<ItemType>> makeNode(const ItemType &an_item) const;
 
     /**
-     * @brief recursively prints the contents of the subtree pointed to by the node pointer
+     * @brief recursively writes the contents of the subtree pointed to by the node pointer
      *
      * @param node that points to the root node in a subtree
+     * @param writer to write to
      */
-    void preorderHelper(std::shared_ptr<BinaryNode<ItemType>> node);
+    void preorderHelper(const std::shared_ptr<BinaryNode<ItemType>> &node, BufferedWriter &writer) const;
 
     /**
      * @brief called by the copy constructor - recursively copies every node in the tree pointed to by the parameter pointer
@@ -0,0 +1,289 @@
+/**
+ * @file LRUCache.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Implementation for LRUCache class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "LRUCache.hpp"
+
+/**
+ * @brief parameterized constructor
+ *
+ * @pre capacity > 0
+ * @param capacity the most entries the cache holds, otherwise it throws exception: PrecondViolatedExcep
+ */
+template <class Key, class Value, class Hash>
+LRUCache<Key, Value, Hash>::LRUCache(const size_t &capacity) : LRUCache(capacity, std::pmr::get_default_resource())
+{
+}
+
+/**
+ * @brief parameterized constructor
+ *
+ * @pre capacity > 0
+ * @param capacity the most entries the cache holds, otherwise it throws exception: PrecondViolatedExcep
+ * @param memory_resource to allocate the entries and the hash map from
+ */
+template <class Key, class Value, class Hash>
+LRUCache<Key, Value, Hash>::LRUCache(const size_t &capacity, std::pmr::memory_resource *memory_resource) : capacity_{capacity},
+                                                                                                         entries_(memory_resource),
+                                                                                                         index_(memory_resource),
+                                                                                                         hit_count_{0},
+                                                                                                         miss_count_{0}
+{
+    if (capacity == 0)
+    {
+        throw std::runtime_error("PrecondViolatedExcep");
+    }
+}
+
+/**
+ * @brief checks if the cache is empty
+ *
+ * @return true if the cache holds no entry,
+ * @return false otherwise
+ */
+template <class Key, class Value, class Hash>
+bool LRUCache<Key, Value, Hash>::isEmpty() const
+{
+    return index_.empty();
+}
+
+/**
+ * @brief gets the number of entries in the cache
+ *
+ * @return the number of entries
+ */
+template <class Key, class Value, class Hash>
+size_t LRUCache<Key, Value, Hash>::getLength() const
+{
+    return index_.size();
+}
+
+/**
+ * @brief gets the most entries the cache holds
+ *
+ * @return the capacity of the cache
+ */
+template <class Key, class Value, class Hash>
+size_t LRUCache<Key, Value, Hash>::getCapacity() const
+{
+    return capacity_;
+}
+
+/**
+ * @brief looks up the value for a key and marks the entry most recently used
+ *
+ * @param key to be looked up
+ * @param value set to the entry's value on a hit, left untouched on a miss
+ * @post counts a hit or a miss
+ * @return true if the key is in the cache,
+ * @return false otherwise
+ */
+template <class Key, class Value, class Hash>
+bool LRUCache<Key, Value, Hash>::get(const Key &key, Value &value)
+{
+    auto found = index_.find(key);
+    if (found == index_.end())
+    {
+        miss_count_++;
+        return false;
+    }
+
+    hit_count_++;
+    value = found->second->second;
+    entries_.splice(entries_.begin(), entries_, found->second);
+    return true;
+}
+
+/**
+ * @brief checks if a key is in the cache, without marking it used or counting a hit or miss
+ *
+ * @param key to be looked up
+ * @return true if the key is in the cache,
+ * @return false otherwise
+ */
+template <class Key, class Value, class Hash>
+bool LRUCache<Key, Value, Hash>::contains(const Key &key) const
+{
+    return index_.find(key) != index_.end();
+}
+
+/**
+ * @brief sets the value for a key and marks the entry most recently used
+ *
+ * @param key of the entry
+ * @param value to be copied into the entry
+ * @post if the key is new and the cache is full, the least recently used entry is evicted first
+ * @return true if the key was not in the cache,
+ * @return false if its value was replaced
+ */
+template <class Key, class Value, class Hash>
+bool LRUCache<Key, Value, Hash>::put(const Key &key, const Value &value)
+{
+    return putEntry(key, value);
+}
+
+/**
+ * @brief sets the value for a key and marks the entry most recently used
+ *
+ * @param key of the entry
+ * @param value to be moved into the entry
+ * @post if the key is new and the cache is full, the least recently used entry is evicted first
+ * @return true if the key was not in the cache,
+ * @return false if its value was replaced
+ */
+template <class Key, class Value, class Hash>
+bool LRUCache<Key, Value, Hash>::put(const Key &key, Value &&value)
+{
+    return putEntry(key, std::move(value));
+}
+
+/**
+ * @brief marks an entry most recently used, without reading it
+ *
+ * @param key of the entry
+ * @return true if the key is in the cache,
+ * @return false otherwise
+ */
+template <class Key, class Value, class Hash>
+bool LRUCache<Key, Value, Hash>::touch(const Key &key)
+{
+    auto found = index_.find(key);
+    if (found == index_.end())
+    {
+        return false;
+    }
+    entries_.splice(entries_.begin(), entries_, found->second);
+    return true;
+}
+
+/**
+ * @brief deletes the entry for a key
+ *
+ * @param key of the entry
+ * @return true if the key was in the cache,
+ * @return false otherwise
+ */
+template <class Key, class Value, class Hash>
+bool LRUCache<Key, Value, Hash>::remove(const Key &key)
+{
+    auto found = index_.find(key);
+    if (found == index_.end())
+    {
+        return false;
+    }
+    EntryIterator entry = found->second;
+    index_.erase(found);
+    entries_.erase(entry);
+    return true;
+}
+
+/**
+ * @brief deletes the least recently used entry
+ *
+ * @return true if there was an entry to be deleted,
+ * @return false otherwise
+ */
+template <class Key, class Value, class Hash>
+bool LRUCache<Key, Value, Hash>::evict()
+{
+    if (entries_.isEmpty())
+    {
+        return false;
+    }
+    EntryIterator oldest = --entries_.end();
+    index_.erase(oldest->first);
+    entries_.erase(oldest);
+    return true;
+}
+
+/**
+ * @brief deletes every entry
+ *
+ * @post the hit and miss counts are kept - resetCounters() clears them
+ */
+template <class Key, class Value, class Hash>
+void LRUCache<Key, Value, Hash>::clear()
+{
+    index_.clear();
+    entries_.clear();
+}
+
+/**
+ * @brief gets the number of get() calls that found their key
+ *
+ * @return the number of hits since the cache was made or the counters were reset
+ */
+template <class Key, class Value, class Hash>
+size_t LRUCache<Key, Value, Hash>::getHitCount() const
+{
+    return hit_count_;
+}
+
+/**
+ * @brief gets the number of get() calls that did not find their key
+ *
+ * @return the number of misses since the cache was made or the counters were reset
+ */
+template <class Key, class Value, class Hash>
+size_t LRUCache<Key, Value, Hash>::getMissCount() const
+{
+    return miss_count_;
+}
+
+/**
+ * @brief sets the hit and miss counts to 0
+ */
+template <class Key, class Value, class Hash>
+void LRUCache<Key, Value, Hash>::resetCounters()
+{
+    hit_count_ = 0;
+    miss_count_ = 0;
+}
+
+//********* PRIVATE METHODS **************//
+
+/**
+ * @brief sets the value for a key and marks the entry most recently used
+ *
+ * @param key of the entry
+ * @param value to be forwarded into the entry
+ * @return true if the key was not in the cache,
+ * @return false if its value was replaced
+ */
+template <class Key, class Value, class Hash>
+template <class Item>
+bool LRUCache<Key, Value, Hash>::putEntry(const Key &key, Item &&value)
+{
+    auto found = index_.find(key);
+    if (found != index_.end())
+    {
+        found->second->second = std::forward<Item>(value);
+        entries_.splice(entries_.begin(), entries_, found->second);
+        return false;
+    }
+
+    if (index_.size() >= capacity_)
+    {
+        evict();
+    }
+
+    // Link the entry in first, and take it out again if the hash map cannot make room for it
+    entries_.emplace_front(key, std::forward<Item>(value));
+    try
+    {
+        index_.emplace(key, entries_.begin());
+    }
+    catch (...)
+    {
+        entries_.pop_front();
+        throw;
+    }
+    return true;
+}
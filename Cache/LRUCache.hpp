@@ -0,0 +1,197 @@
+/**
+ * @file LRUCache.hpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Interface for LRUCache class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef LRU_CACHE_
+#define LRU_CACHE_
+
+#include <functional>
+#include <memory_resource>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include "../List/DoublyLinkedList.hpp"
+
+/**
+ * @brief A fixed-capacity key-value cache that evicts the least recently used entry to make room for a new one
+ *
+ * @tparam Key of the entries - it must be hashable by Hash and comparable with ==
+ * @tparam Value of the entries
+ * @tparam Hash function object hashing a Key
+ * @note The entries sit in a DoublyLinkedList from most to least recently used, and a hash map leads from each key
+ * straight to its node. Using an entry splices its node to the front, and eviction erases the last one - so get(),
+ * put(), touch(), remove() and evict() all take O(1) on average, however many entries there are
+ * @note Not safe to use from several threads at once - ShardedLRUCache is
+ */
+template <class Key, class Value, class Hash = std::hash<Key>>
+class LRUCache
+{
+public:
+    /**
+     * @brief parameterized constructor
+     *
+     * @pre capacity > 0
+     * @param capacity the most entries the cache holds, otherwise it throws exception: PrecondViolatedExcep
+     */
+    explicit LRUCache(const size_t &capacity);
+
+    /**
+     * @brief parameterized constructor
+     *
+     * @pre capacity > 0
+     * @param capacity the most entries the cache holds, otherwise it throws exception: PrecondViolatedExcep
+     * @param memory_resource to allocate the entries and the hash map from
+     */
+    LRUCache(const size_t &capacity, std::pmr::memory_resource *memory_resource);
+
+    LRUCache(const LRUCache<Key, Value, Hash> &a_cache) = delete;
+    LRUCache<Key, Value, Hash> &operator=(const LRUCache<Key, Value, Hash> &a_cache) = delete;
+
+    /**
+     * @brief checks if the cache is empty
+     *
+     * @return true if the cache holds no entry,
+     * @return false otherwise
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief gets the number of entries in the cache
+     *
+     * @return the number of entries
+     */
+    size_t getLength() const;
+
+    /**
+     * @brief gets the most entries the cache holds
+     *
+     * @return the capacity of the cache
+     */
+    size_t getCapacity() const;
+
+    /**
+     * @brief looks up the value for a key and marks the entry most recently used
+     *
+     * @param key to be looked up
+     * @param value set to the entry's value on a hit, left untouched on a miss
+     * @post counts a hit or a miss
+     * @return true if the key is in the cache,
+     * @return false otherwise
+     */
+    bool get(const Key &key, Value &value);
+
+    /**
+     * @brief checks if a key is in the cache, without marking it used or counting a hit or miss
+     *
+     * @param key to be looked up
+     * @return true if the key is in the cache,
+     * @return false otherwise
+     */
+    bool contains(const Key &key) const;
+
+    /**
+     * @brief sets the value for a key and marks the entry most recently used
+     *
+     * @param key of the entry
+     * @param value to be copied into the entry
+     * @post if the key is new and the cache is full, the least recently used entry is evicted first
+     * @return true if the key was not in the cache,
+     * @return false if its value was replaced
+     */
+    bool put(const Key &key, const Value &value);
+
+    /**
+     * @brief sets the value for a key and marks the entry most recently used
+     *
+     * @param key of the entry
+     * @param value to be moved into the entry
+     * @post if the key is new and the cache is full, the least recently used entry is evicted first
+     * @return true if the key was not in the cache,
+     * @return false if its value was replaced
+     */
+    bool put(const Key &key, Value &&value);
+
+    /**
+     * @brief marks an entry most recently used, without reading it
+     *
+     * @param key of the entry
+     * @return true if the key is in the cache,
+     * @return false otherwise
+     */
+    bool touch(const Key &key);
+
+    /**
+     * @brief deletes the entry for a key
+     *
+     * @param key of the entry
+     * @return true if the key was in the cache,
+     * @return false otherwise
+     */
+    bool remove(const Key &key);
+
+    /**
+     * @brief deletes the least recently used entry
+     *
+     * @return true if there was an entry to be deleted,
+     * @return false otherwise
+     */
+    bool evict();
+
+    /**
+     * @brief deletes every entry
+     *
+     * @post the hit and miss counts are kept - resetCounters() clears them
+     */
+    void clear();
+
+    /**
+     * @brief gets the number of get() calls that found their key
+     *
+     * @return the number of hits since the cache was made or the counters were reset
+     */
+    size_t getHitCount() const;
+
+    /**
+     * @brief gets the number of get() calls that did not find their key
+     *
+     * @return the number of misses since the cache was made or the counters were reset
+     */
+    size_t getMissCount() const;
+
+    /**
+     * @brief sets the hit and miss counts to 0
+     */
+    void resetCounters();
+
+private:
+    using Entry = std::pair<Key, Value>;
+    using EntryIterator = typename DoublyLinkedList<Entry>::iterator;
+
+    size_t capacity_;
+    // Most recently used first
+    DoublyLinkedList<Entry> entries_;
+    std::pmr::unordered_map<Key, EntryIterator, Hash> index_;
+    size_t hit_count_;
+    size_t miss_count_;
+
+    /**
+     * @brief sets the value for a key and marks the entry most recently used
+     *
+     * @param key of the entry
+     * @param value to be forwarded into the entry
+     * @return true if the key was not in the cache,
+     * @return false if its value was replaced
+     */
+    template <class Item>
+    bool putEntry(const Key &key, Item &&value);
+};
+
+#include "LRUCache.cpp"
+#endif
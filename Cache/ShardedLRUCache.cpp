@@ -0,0 +1,289 @@
+/**
+ * @file ShardedLRUCache.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Implementation for ShardedLRUCache class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "ShardedLRUCache.hpp"
+
+/**
+ * @brief parameterized constructor
+ *
+ * @pre capacity > 0 and shard_count > 0
+ * @param capacity the most entries the cache holds, split between the shards as evenly as possible - otherwise it throws
+ * exception: PrecondViolatedExcep
+ * @param shard_count the number of shards, capped at capacity so that every shard holds at least one entry
+ */
+template <class Key, class Value, class Hash>
+ShardedLRUCache<Key, Value, Hash>::ShardedLRUCache(const size_t &capacity, const size_t &shard_count) : ShardedLRUCache(capacity, shard_count, std::pmr::get_default_resource())
+{
+}
+
+/**
+ * @brief parameterized constructor
+ *
+ * @pre capacity > 0 and shard_count > 0
+ * @param capacity the most entries the cache holds, split between the shards as evenly as possible - otherwise it throws
+ * exception: PrecondViolatedExcep
+ * @param shard_count the number of shards, capped at capacity so that every shard holds at least one entry
+ * @param memory_resource to allocate the entries and the hash maps from - it must be safe to use from several
+ * threads at once
+ */
+template <class Key, class Value, class Hash>
+ShardedLRUCache<Key, Value, Hash>::ShardedLRUCache(const size_t &capacity, const size_t &shard_count, std::pmr::memory_resource *memory_resource)
+{
+    if (capacity == 0 || shard_count == 0)
+    {
+        throw std::runtime_error("PrecondViolatedExcep");
+    }
+
+    // Hand out exactly capacity entries - the first capacity % count shards hold one more than the rest
+    size_t count = shard_count < capacity ? shard_count : capacity;
+    shards_.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        size_t shard_capacity = capacity / count + (i < capacity % count ? 1 : 0);
+        shards_.push_back(std::make_unique<Shard>(shard_capacity, memory_resource));
+    }
+}
+
+/**
+ * @brief gets the number of entries in the cache
+ *
+ * @return the number of entries, which other threads may change at any moment
+ */
+template <class Key, class Value, class Hash>
+size_t ShardedLRUCache<Key, Value, Hash>::getLength() const
+{
+    size_t length = 0;
+    for (const std::unique_ptr<Shard> &shard : shards_)
+    {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        length += shard->cache.getLength();
+    }
+    return length;
+}
+
+/**
+ * @brief gets the most entries the cache holds
+ *
+ * @return the capacity of the cache - the sum of the shards' capacities
+ */
+template <class Key, class Value, class Hash>
+size_t ShardedLRUCache<Key, Value, Hash>::getCapacity() const
+{
+    size_t capacity = 0;
+    for (const std::unique_ptr<Shard> &shard : shards_)
+    {
+        capacity += shard->cache.getCapacity();
+    }
+    return capacity;
+}
+
+/**
+ * @brief gets the number of shards
+ *
+ * @return the number of shards
+ */
+template <class Key, class Value, class Hash>
+size_t ShardedLRUCache<Key, Value, Hash>::getShardCount() const
+{
+    return shards_.size();
+}
+
+/**
+ * @brief looks up the value for a key and marks the entry most recently used in its shard
+ *
+ * @param key to be looked up
+ * @param value set to a copy of the entry's value on a hit, left untouched on a miss
+ * @post counts a hit or a miss
+ * @return true if the key is in the cache,
+ * @return false otherwise
+ */
+template <class Key, class Value, class Hash>
+bool ShardedLRUCache<Key, Value, Hash>::get(const Key &key, Value &value)
+{
+    Shard &shard = getShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache.get(key, value);
+}
+
+/**
+ * @brief checks if a key is in the cache, without marking it used or counting a hit or miss
+ *
+ * @param key to be looked up
+ * @return true if the key is in the cache,
+ * @return false otherwise
+ */
+template <class Key, class Value, class Hash>
+bool ShardedLRUCache<Key, Value, Hash>::contains(const Key &key) const
+{
+    Shard &shard = getShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache.contains(key);
+}
+
+/**
+ * @brief sets the value for a key and marks the entry most recently used in its shard
+ *
+ * @param key of the entry
+ * @param value to be copied into the entry
+ * @post if the key is new and its shard is full, the shard's least recently used entry is evicted first
+ * @return true if the key was not in the cache,
+ * @return false if its value was replaced
+ */
+template <class Key, class Value, class Hash>
+bool ShardedLRUCache<Key, Value, Hash>::put(const Key &key, const Value &value)
+{
+    Shard &shard = getShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache.put(key, value);
+}
+
+/**
+ * @brief sets the value for a key and marks the entry most recently used in its shard
+ *
+ * @param key of the entry
+ * @param value to be moved into the entry
+ * @post if the key is new and its shard is full, the shard's least recently used entry is evicted first
+ * @return true if the key was not in the cache,
+ * @return false if its value was replaced
+ */
+template <class Key, class Value, class Hash>
+bool ShardedLRUCache<Key, Value, Hash>::put(const Key &key, Value &&value)
+{
+    Shard &shard = getShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache.put(key, std::move(value));
+}
+
+/**
+ * @brief marks an entry most recently used in its shard, without reading it
+ *
+ * @param key of the entry
+ * @return true if the key is in the cache,
+ * @return false otherwise
+ */
+template <class Key, class Value, class Hash>
+bool ShardedLRUCache<Key, Value, Hash>::touch(const Key &key)
+{
+    Shard &shard = getShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache.touch(key);
+}
+
+/**
+ * @brief deletes the entry for a key
+ *
+ * @param key of the entry
+ * @return true if the key was in the cache,
+ * @return false otherwise
+ */
+template <class Key, class Value, class Hash>
+bool ShardedLRUCache<Key, Value, Hash>::remove(const Key &key)
+{
+    Shard &shard = getShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache.remove(key);
+}
+
+/**
+ * @brief deletes every entry, one shard at a time
+ *
+ * @post the hit and miss counts are kept - resetCounters() clears them
+ */
+template <class Key, class Value, class Hash>
+void ShardedLRUCache<Key, Value, Hash>::clear()
+{
+    for (std::unique_ptr<Shard> &shard : shards_)
+    {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->cache.clear();
+    }
+}
+
+/**
+ * @brief gets the number of get() calls that found their key
+ *
+ * @return the number of hits since the cache was made or the counters were reset
+ */
+template <class Key, class Value, class Hash>
+size_t ShardedLRUCache<Key, Value, Hash>::getHitCount() const
+{
+    size_t hit_count = 0;
+    for (const std::unique_ptr<Shard> &shard : shards_)
+    {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        hit_count += shard->cache.getHitCount();
+    }
+    return hit_count;
+}
+
+/**
+ * @brief gets the number of get() calls that did not find their key
+ *
+ * @return the number of misses since the cache was made or the counters were reset
+ */
+template <class Key, class Value, class Hash>
+size_t ShardedLRUCache<Key, Value, Hash>::getMissCount() const
+{
+    size_t miss_count = 0;
+    for (const std::unique_ptr<Shard> &shard : shards_)
+    {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        miss_count += shard->cache.getMissCount();
+    }
+    return miss_count;
+}
+
+/**
+ * @brief sets the hit and miss counts to 0
+ */
+template <class Key, class Value, class Hash>
+void ShardedLRUCache<Key, Value, Hash>::resetCounters()
+{
+    for (std::unique_ptr<Shard> &shard : shards_)
+    {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->cache.resetCounters();
+    }
+}
+
+//********* PRIVATE METHODS **************//
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param capacity the most entries the shard holds
+ * @param memory_resource to allocate the entries and the hash map from
+ */
+template <class Key, class Value, class Hash>
+ShardedLRUCache<Key, Value, Hash>::Shard::Shard(const size_t &capacity, std::pmr::memory_resource *memory_resource) : cache(capacity, memory_resource)
+{
+}
+
+/**
+ * @brief gets the shard a key belongs to
+ *
+ * @param key to be looked up
+ * @return the key's shard
+ */
+template <class Key, class Value, class Hash>
+typename ShardedLRUCache<Key, Value, Hash>::Shard &ShardedLRUCache<Key, Value, Hash>::getShardOf(const Key &key) const
+{
+    if (shards_.size() == 1)
+    {
+        return *shards_[0];
+    }
+
+    // Pick the shard by the top bits of the scrambled hash - the low bits, which the shard's own hash map buckets by,
+    // would leave each shard with keys that all fall in a fraction of its buckets. Multiplying the top 32 bits by the
+    // shard count and keeping the high half maps them onto any number of shards without a division
+    std::uint64_t scrambled = static_cast<std::uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ull;
+    return *shards_[((scrambled >> 32) * shards_.size()) >> 32];
+}
@@ -0,0 +1,200 @@
+/**
+ * @file ShardedLRUCache.hpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Interface for ShardedLRUCache class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SHARDED_LRU_CACHE_
+#define SHARDED_LRU_CACHE_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include "LRUCache.hpp"
+
+/**
+ * @brief An LRUCache split into shards by key hash, each behind its own lock, that any number of threads can use at once
+ *
+ * @tparam Key of the entries - it must be hashable by Hash and comparable with ==
+ * @tparam Value of the entries
+ * @tparam Hash function object hashing a Key
+ * @note Threads working on keys in different shards never wait for each other. Each shard evicts its own least
+ * recently used entry, so eviction order is only approximately least recently used across the whole cache
+ */
+template <class Key, class Value, class Hash = std::hash<Key>>
+class ShardedLRUCache
+{
+public:
+    /**
+     * @brief parameterized constructor
+     *
+     * @pre capacity > 0 and shard_count > 0
+     * @param capacity the most entries the cache holds, split between the shards as evenly as possible - otherwise it throws
+     * exception: PrecondViolatedExcep
+     * @param shard_count the number of shards, capped at capacity so that every shard holds at least one entry
+     */
+    explicit ShardedLRUCache(const size_t &capacity, const size_t &shard_count = 16);
+
+    /**
+     * @brief parameterized constructor
+     *
+     * @pre capacity > 0 and shard_count > 0
+     * @param capacity the most entries the cache holds, split between the shards as evenly as possible - otherwise it throws
+     * exception: PrecondViolatedExcep
+     * @param shard_count the number of shards, capped at capacity so that every shard holds at least one entry
+     * @param memory_resource to allocate the entries and the hash maps from - it must be safe to use from several
+     * threads at once
+     */
+    ShardedLRUCache(const size_t &capacity, const size_t &shard_count, std::pmr::memory_resource *memory_resource);
+
+    ShardedLRUCache(const ShardedLRUCache<Key, Value, Hash> &a_cache) = delete;
+    ShardedLRUCache<Key, Value, Hash> &operator=(const ShardedLRUCache<Key, Value, Hash> &a_cache) = delete;
+
+    /**
+     * @brief gets the number of entries in the cache
+     *
+     * @return the number of entries, which other threads may change at any moment
+     */
+    size_t getLength() const;
+
+    /**
+     * @brief gets the most entries the cache holds
+     *
+     * @return the capacity of the cache - the sum of the shards' capacities
+     */
+    size_t getCapacity() const;
+
+    /**
+     * @brief gets the number of shards
+     *
+     * @return the number of shards
+     */
+    size_t getShardCount() const;
+
+    /**
+     * @brief looks up the value for a key and marks the entry most recently used in its shard
+     *
+     * @param key to be looked up
+     * @param value set to a copy of the entry's value on a hit, left untouched on a miss
+     * @post counts a hit or a miss
+     * @return true if the key is in the cache,
+     * @return false otherwise
+     */
+    bool get(const Key &key, Value &value);
+
+    /**
+     * @brief checks if a key is in the cache, without marking it used or counting a hit or miss
+     *
+     * @param key to be looked up
+     * @return true if the key is in the cache,
+     * @return false otherwise
+     */
+    bool contains(const Key &key) const;
+
+    /**
+     * @brief sets the value for a key and marks the entry most recently used in its shard
+     *
+     * @param key of the entry
+     * @param value to be copied into the entry
+     * @post if the key is new and its shard is full, the shard's least recently used entry is evicted first
+     * @return true if the key was not in the cache,
+     * @return false if its value was replaced
+     */
+    bool put(const Key &key, const Value &value);
+
+    /**
+     * @brief sets the value for a key and marks the entry most recently used in its shard
+     *
+     * @param key of the entry
+     * @param value to be moved into the entry
+     * @post if the key is new and its shard is full, the shard's least recently used entry is evicted first
+     * @return true if the key was not in the cache,
+     * @return false if its value was replaced
+     */
+    bool put(const Key &key, Value &&value);
+
+    /**
+     * @brief marks an entry most recently used in its shard, without reading it
+     *
+     * @param key of the entry
+     * @return true if the key is in the cache,
+     * @return false otherwise
+     */
+    bool touch(const Key &key);
+
+    /**
+     * @brief deletes the entry for a key
+     *
+     * @param key of the entry
+     * @return true if the key was in the cache,
+     * @return false otherwise
+     */
+    bool remove(const Key &key);
+
+    /**
+     * @brief deletes every entry, one shard at a time
+     *
+     * @post the hit and miss counts are kept - resetCounters() clears them
+     */
+    void clear();
+
+    /**
+     * @brief gets the number of get() calls that found their key
+     *
+     * @return the number of hits since the cache was made or the counters were reset
+     */
+    size_t getHitCount() const;
+
+    /**
+     * @brief gets the number of get() calls that did not find their key
+     *
+     * @return the number of misses since the cache was made or the counters were reset
+     */
+    size_t getMissCount() const;
+
+    /**
+     * @brief sets the hit and miss counts to 0
+     */
+    void resetCounters();
+
+private:
+    /**
+     * @brief one shard - an LRUCache and the lock guarding it, on cache lines of their own
+     */
+    struct alignas(64) Shard
+    {
+        /**
+         * @brief parameterized constructor
+         *
+         * @param capacity the most entries the shard holds
+         * @param memory_resource to allocate the entries and the hash map from
+         */
+        Shard(const size_t &capacity, std::pmr::memory_resource *memory_resource);
+
+        mutable std::mutex mutex;
+        LRUCache<Key, Value, Hash> cache;
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+    Hash hash_;
+
+    /**
+     * @brief gets the shard a key belongs to
+     *
+     * @param key to be looked up
+     * @return the key's shard
+     */
+    Shard &getShardOf(const Key &key) const;
+};
+
+#include "ShardedLRUCache.cpp"
+#endif
@@ -0,0 +1,565 @@
+/**
+ * @file CompactLinkedList.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Implementation for CompactLinkedList class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "CompactLinkedList.hpp"
+
+/**
+ * @brief default constructor
+ */
+template <class ItemType>
+CompactLinkedList<ItemType>::CompactLinkedList() : CompactLinkedList(std::pmr::get_default_resource())
+{
+}
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param memory_resource to allocate the node array from
+ */
+template <class ItemType>
+CompactLinkedList<ItemType>::CompactLinkedList(std::pmr::memory_resource *memory_resource) : slots_{nullptr},
+                                                                                            capacity_{0},
+                                                                                            used_{0},
+                                                                                            free_{NIL_},
+                                                                                            first_{NIL_},
+                                                                                            last_{NIL_},
+                                                                                            item_count_{0},
+                                                                                            memory_resource_{memory_resource}
+{
+}
+
+/**
+ * @brief copy constructor
+ *
+ * @param a_list to be copied
+ * @note the copy allocates its node array from the same memory resource as a_list, and lays it out in list order
+ */
+template <class ItemType>
+CompactLinkedList<ItemType>::CompactLinkedList(const CompactLinkedList<ItemType> &a_list) : CompactLinkedList(a_list.memory_resource_)
+{
+    copyFrom(a_list);
+}
+
+/**
+ * @brief destructor - destroys every item and frees the node array
+ */
+template <class ItemType>
+CompactLinkedList<ItemType>::~CompactLinkedList()
+{
+    clear();
+    if (slots_ != nullptr)
+    {
+        memory_resource_->deallocate(slots_, sizeof(Slot) * capacity_, alignof(Slot));
+    }
+}
+
+/**
+ * @brief copy assignment operator
+ *
+ * @param a_list to be copied
+ * @return a reference to this list
+ */
+template <class ItemType>
+CompactLinkedList<ItemType> &CompactLinkedList<ItemType>::operator=(const CompactLinkedList<ItemType> &a_list)
+{
+    if (this != &a_list)
+    {
+        // Copy first so that this list is left untouched if copying throws, then trade node arrays with the copy
+        CompactLinkedList<ItemType> copy(memory_resource_);
+        copy.copyFrom(a_list);
+        clear();
+        std::swap(slots_, copy.slots_);
+        std::swap(capacity_, copy.capacity_);
+        std::swap(used_, copy.used_);
+        std::swap(free_, copy.free_);
+        std::swap(first_, copy.first_);
+        std::swap(last_, copy.last_);
+        std::swap(item_count_, copy.item_count_);
+    }
+    return *this;
+}
+
+/**
+ * @brief checks if the list is empty
+ *
+ * @return true if the list is empty,
+ * @return false otherwise
+ */
+template <class ItemType>
+bool CompactLinkedList<ItemType>::isEmpty() const
+{
+    return item_count_ == 0;
+}
+
+/**
+ * @brief gets the length of the list
+ *
+ * @return the number of items in the list
+ */
+template <class ItemType>
+size_t CompactLinkedList<ItemType>::getLength() const
+{
+    return item_count_;
+}
+
+/**
+ * @brief gets the item at a position
+ *
+ * @pre 0 <= position < item_count_
+ * @param position of the item to be retrieved
+ * @return the item at position in list if there is one, otherwise it throws exception: PrecondViolatedExcep
+ */
+template <class ItemType>
+ItemType CompactLinkedList<ItemType>::getItem(const size_t &position) const
+{
+    if (position < item_count_)
+    {
+        return *slots_[locate(position)].item();
+    }
+    else
+    {
+        throw std::runtime_error("PrecondViolatedExcep");
+    }
+}
+
+/**
+ * @brief inserts an item at a position
+ *
+ * @param position indicating point of insertion
+ * @param new_element to be inserted in list
+ * @post new_element is added at position in list (the item previously at that position is now at position+1)
+ * @return true always - it always inserts, if position > item_count_, then it inserts at end of list
+ */
+template <class ItemType>
+bool CompactLinkedList<ItemType>::insert(const size_t &position, const ItemType &new_element)
+{
+    // Copy first, so that a throwing copy leaves the list untouched and new_element may refer into the list
+    ItemType item(new_element);
+
+    std::uint32_t index = takeSlot();
+    Slot &slot = slots_[index];
+    try
+    {
+        new (slot.item()) ItemType(std::move(item));
+    }
+    catch (...)
+    {
+        slot.next = free_;
+        free_ = index;
+        throw;
+    }
+
+    // The array may have been laid out again by takeSlot(), so the position is only looked up now
+    if (position >= item_count_)
+    {
+        slot.next = NIL_;
+        slot.prev = last_;
+        if (last_ == NIL_)
+        {
+            first_ = index;
+        }
+        else
+        {
+            slots_[last_].next = index;
+        }
+        last_ = index;
+    }
+    else
+    {
+        std::uint32_t following = locate(position);
+        slot.next = following;
+        slot.prev = slots_[following].prev;
+        if (slot.prev == NIL_)
+        {
+            first_ = index;
+        }
+        else
+        {
+            slots_[slot.prev].next = index;
+        }
+        slots_[following].prev = index;
+    }
+
+    item_count_++;
+    return true;
+}
+
+/**
+ * @brief inserts an item at the end of the list
+ *
+ * @param new_element to be inserted in list
+ * @post new_element is added at the end of the list
+ * @return true always - it always inserts
+ */
+template <class ItemType>
+bool CompactLinkedList<ItemType>::push_back(const ItemType &new_element)
+{
+    return insert(item_count_, new_element);
+}
+
+/**
+ * @brief inserts an item at the front of the list
+ *
+ * @param new_element to be inserted in list
+ * @post new_element is added at the front of the list
+ * @return true always - it always inserts
+ */
+template <class ItemType>
+bool CompactLinkedList<ItemType>::push_front(const ItemType &new_element)
+{
+    return insert(0, new_element);
+}
+
+/**
+ * @brief deletes the item at a position
+ *
+ * @param position indicating point of deletion
+ * @post item at position is deleted, if any. List order is retained
+ * @return true if there is an item at position to be deleted,
+ * @return false otherwise
+ */
+template <class ItemType>
+bool CompactLinkedList<ItemType>::remove(const size_t &position)
+{
+    if (position >= item_count_)
+    {
+        return false;
+    }
+
+    std::uint32_t index = locate(position);
+    Slot &slot = slots_[index];
+    if (slot.prev == NIL_)
+    {
+        first_ = slot.next;
+    }
+    else
+    {
+        slots_[slot.prev].next = slot.next;
+    }
+    if (slot.next == NIL_)
+    {
+        last_ = slot.prev;
+    }
+    else
+    {
+        slots_[slot.next].prev = slot.prev;
+    }
+
+    // Put the slot on the freelist for the next insert
+    slot.item()->~ItemType();
+    slot.next = free_;
+    free_ = index;
+    item_count_--;
+    return true;
+}
+
+/**
+ * @brief deletes the last item
+ *
+ * @post the last item is deleted, if any. List order is retained
+ * @return true if there is an item to be deleted,
+ * @return false otherwise
+ */
+template <class ItemType>
+bool CompactLinkedList<ItemType>::pop_back()
+{
+    return remove(item_count_ - 1);
+}
+
+/**
+ * @brief deletes the first item
+ *
+ * @post the first item is deleted, if any. List order is retained
+ * @return true if there is an item to be deleted,
+ * @return false otherwise
+ */
+template <class ItemType>
+bool CompactLinkedList<ItemType>::pop_front()
+{
+    return remove(0);
+}
+
+/**
+ * @brief deletes all items in the list and item_count_ is set to 0
+ *
+ * @post the node array is kept for reuse - compact() frees it
+ */
+template <class ItemType>
+void CompactLinkedList<ItemType>::clear()
+{
+    for (std::uint32_t index = first_; index != NIL_; index = slots_[index].next)
+    {
+        slots_[index].item()->~ItemType();
+    }
+    used_ = 0;
+    free_ = NIL_;
+    first_ = NIL_;
+    last_ = NIL_;
+    item_count_ = 0;
+}
+
+/**
+ * @brief prints the contents of the list
+ *
+ * @note the items are written in large blocks, and std::cout is flushed once at the end
+ */
+template <class ItemType>
+void CompactLinkedList<ItemType>::display()
+{
+    display(std::cout);
+    std::cout.flush();
+}
+
+/**
+ * @brief writes the contents of the list to a stream, separated by spaces and ending in a newline
+ *
+ * @param out the stream to write to - it is written in large blocks and never flushed
+ */
+template <class ItemType>
+void CompactLinkedList<ItemType>::display(std::ostream &out) const
+{
+    BufferedWriter writer(out);
+    display(writer);
+    writer.flush();
+}
+
+/**
+ * @brief writes the contents of the list into a writer, separated by spaces and ending in a newline
+ *
+ * @param writer to write to - nothing reaches its sink until it fills up or is flushed
+ */
+template <class ItemType>
+void CompactLinkedList<ItemType>::display(BufferedWriter &writer) const
+{
+    for (std::uint32_t index = first_; index != NIL_; index = slots_[index].next)
+    {
+        writer.write(*slots_[index].item());
+        writer.put(slots_[index].next == NIL_ ? '\n' : ' ');
+    }
+}
+
+/**
+ * @brief swaps the items at positions i and j (i must be less than j)
+ *
+ * @pre i < j
+ * @param i is the index (integer) of the first item we are swapping in the list
+ * @param j is the index (integer) of the second item we are swapping in the list
+ * @post swaps the element at position i with the element at position j
+ */
+template <class ItemType>
+void CompactLinkedList<ItemType>::swap(const int &i, const int &j)
+{
+    if (0 <= i && i < j && static_cast<size_t>(j) < item_count_)
+    {
+        std::swap(*slots_[locate(i)].item(), *slots_[locate(j)].item());
+    }
+}
+
+/**
+ * @brief lays the nodes out again in list order, in an array just big enough to hold them
+ *
+ * @post the freelist is empty and walking the list reads the array from front to back
+ * @note takes O(n). If moving an item throws, the list is left untouched
+ */
+template <class ItemType>
+void CompactLinkedList<ItemType>::compact()
+{
+    if (item_count_ > 0)
+    {
+        relayout(static_cast<std::uint32_t>(item_count_));
+    }
+    else if (slots_ != nullptr)
+    {
+        memory_resource_->deallocate(slots_, sizeof(Slot) * capacity_, alignof(Slot));
+        slots_ = nullptr;
+        capacity_ = 0;
+        used_ = 0;
+        free_ = NIL_;
+    }
+}
+
+/**
+ * @brief gets the number of nodes the array has room for
+ *
+ * @return the capacity of the node array
+ */
+template <class ItemType>
+size_t CompactLinkedList<ItemType>::getCapacity() const
+{
+    return capacity_;
+}
+
+/**
+ * @brief gets the memory resource the list allocates its node array from
+ *
+ * @return a pointer to the memory resource
+ */
+template <class ItemType>
+std::pmr::memory_resource *CompactLinkedList<ItemType>::getMemoryResource() const
+{
+    return memory_resource_;
+}
+
+//********* PRIVATE METHODS **************//
+
+/**
+ * @brief gets the node's item
+ *
+ * @return a pointer to the item
+ */
+template <class ItemType>
+ItemType *CompactLinkedList<ItemType>::Slot::item()
+{
+    return std::launder(reinterpret_cast<ItemType *>(storage));
+}
+
+/**
+ * @brief finds the node at a position, walking from whichever end of the list is nearer
+ *
+ * @pre position < item_count_
+ * @param position of the node
+ * @return the index of the node
+ */
+template <class ItemType>
+std::uint32_t CompactLinkedList<ItemType>::locate(const size_t &position) const
+{
+    std::uint32_t index;
+    if (position < item_count_ / 2)
+    {
+        index = first_;
+        for (size_t i = 0; i < position; i++)
+        {
+            index = slots_[index].next;
+        }
+    }
+    else
+    {
+        index = last_;
+        for (size_t i = item_count_ - 1; i > position; i--)
+        {
+            index = slots_[index].prev;
+        }
+    }
+    return index;
+}
+
+/**
+ * @brief takes a slot off the freelist, or from the unused end of the array, growing the array if it is full
+ *
+ * @note growing the array lays the nodes out again, so indices found before the call are stale after it
+ * @return the index of the slot
+ */
+template <class ItemType>
+std::uint32_t CompactLinkedList<ItemType>::takeSlot()
+{
+    if (free_ != NIL_)
+    {
+        std::uint32_t index = free_;
+        free_ = slots_[index].next;
+        return index;
+    }
+
+    if (used_ == capacity_)
+    {
+        // NIL_ itself is never an index, so the array holds at most NIL_ slots
+        if (capacity_ == NIL_)
+        {
+            throw std::length_error("CompactLinkedList");
+        }
+
+        // Doubling keeps the cost of growing to O(1) per insert on average
+        relayout(capacity_ < NIL_ / 2 ? std::max<std::uint32_t>(2 * capacity_, 16) : NIL_);
+    }
+    return used_++;
+}
+
+/**
+ * @brief moves the items, in list order, into the front of a new array and frees the old one
+ *
+ * @pre item_count_ <= new_capacity
+ * @param new_capacity the number of slots in the new array
+ * @note if moving an item throws, the list is left untouched
+ */
+template <class ItemType>
+void CompactLinkedList<ItemType>::relayout(const std::uint32_t &new_capacity)
+{
+    Slot *new_slots = static_cast<Slot *>(memory_resource_->allocate(sizeof(Slot) * new_capacity, alignof(Slot)));
+    for (std::uint32_t index = 0; index < new_capacity; index++)
+    {
+        new (new_slots + index) Slot;
+    }
+
+    // Node k of the list goes in slot k, so its links are simply k - 1 and k + 1 - and k - 1 wraps around to NIL_
+    std::uint32_t moved = 0;
+    try
+    {
+        for (std::uint32_t index = first_; index != NIL_; index = slots_[index].next)
+        {
+            new (new_slots[moved].item()) ItemType(std::move_if_noexcept(*slots_[index].item()));
+            new_slots[moved].prev = moved - 1;
+            new_slots[moved].next = moved + 1;
+            moved++;
+        }
+    }
+    catch (...)
+    {
+        for (std::uint32_t index = 0; index < moved; index++)
+        {
+            new_slots[index].item()->~ItemType();
+        }
+        memory_resource_->deallocate(new_slots, sizeof(Slot) * new_capacity, alignof(Slot));
+        throw;
+    }
+
+    if (slots_ != nullptr)
+    {
+        for (std::uint32_t index = first_; index != NIL_; index = slots_[index].next)
+        {
+            slots_[index].item()->~ItemType();
+        }
+        memory_resource_->deallocate(slots_, sizeof(Slot) * capacity_, alignof(Slot));
+    }
+
+    slots_ = new_slots;
+    capacity_ = new_capacity;
+    used_ = moved;
+    free_ = NIL_;
+    if (moved == 0)
+    {
+        first_ = NIL_;
+        last_ = NIL_;
+    }
+    else
+    {
+        slots_[moved - 1].next = NIL_;
+        first_ = 0;
+        last_ = moved - 1;
+    }
+}
+
+/**
+ * @brief appends copies of every item of a_list
+ *
+ * @param a_list to be copied
+ */
+template <class ItemType>
+void CompactLinkedList<ItemType>::copyFrom(const CompactLinkedList<ItemType> &a_list)
+{
+    // Make room for every item at once, so the copy is laid out in list order with no regrowth
+    if (item_count_ + a_list.item_count_ > capacity_)
+    {
+        relayout(static_cast<std::uint32_t>(item_count_ + a_list.item_count_));
+    }
+    for (std::uint32_t index = a_list.first_; index != NIL_; index = a_list.slots_[index].next)
+    {
+        push_back(*a_list.slots_[index].item());
+    }
+}
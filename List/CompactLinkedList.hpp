@@ -0,0 +1,276 @@
+/**
+ * @file CompactLinkedList.hpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Interface for CompactLinkedList class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef COMPACT_LINKED_LIST_
+#define COMPACT_LINKED_LIST_
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "../Output/BufferedWriter.hpp"
+
+/**
+ * @brief A doubly linked list whose nodes live side by side in one array and link to each other by 32-bit index, with
+ * the same interface as DoublyLinkedList
+ *
+ * @note A node costs its item plus two 4-byte links - no pointers, no control block and no allocation of its own.
+ * Removed nodes go on a freelist and are reused by later inserts
+ * @note Growing the array and compact() lay the nodes out again in list order, so walking the list reads the array
+ * from front to back
+ */
+template <class ItemType>
+class CompactLinkedList
+{
+public:
+    /**
+     * @brief default constructor
+     */
+    CompactLinkedList();
+
+    /**
+     * @brief parameterized constructor
+     *
+     * @param memory_resource to allocate the node array from
+     */
+    explicit CompactLinkedList(std::pmr::memory_resource *memory_resource);
+
+    /**
+     * @brief copy constructor
+     *
+     * @param a_list to be copied
+     * @note the copy allocates its node array from the same memory resource as a_list, and lays it out in list order
+     */
+    CompactLinkedList(const CompactLinkedList<ItemType> &a_list);
+
+    /**
+     * @brief destructor - destroys every item and frees the node array
+     */
+    ~CompactLinkedList();
+
+    /**
+     * @brief copy assignment operator
+     *
+     * @param a_list to be copied
+     * @return a reference to this list
+     */
+    CompactLinkedList<ItemType> &operator=(const CompactLinkedList<ItemType> &a_list);
+
+    /**
+     * @brief checks if the list is empty
+     *
+     * @return true if the list is empty,
+     * @return false otherwise
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief gets the length of the list
+     *
+     * @return the number of items in the list
+     */
+    size_t getLength() const;
+
+    /**
+     * @brief gets the item at a position
+     *
+     * @pre 0 <= position < item_count_
+     * @param position of the item to be retrieved
+     * @return the item at position in list if there is one, otherwise it throws exception: PrecondViolatedExcep
+     */
+    ItemType getItem(const size_t &position) const;
+
+    /**
+     * @brief inserts an item at a position
+     *
+     * @param position indicating point of insertion
+     * @param new_element to be inserted in list
+     * @post new_element is added at position in list (the item previously at that position is now at position+1)
+     * @return true always - it always inserts, if position > item_count_, then it inserts at end of list
+     */
+    bool insert(const size_t &position, const ItemType &new_element);
+
+    /**
+     * @brief inserts an item at the end of the list
+     *
+     * @param new_element to be inserted in list
+     * @post new_element is added at the end of the list
+     * @return true always - it always inserts
+     */
+    bool push_back(const ItemType &new_element);
+
+    /**
+     * @brief inserts an item at the front of the list
+     *
+     * @param new_element to be inserted in list
+     * @post new_element is added at the front of the list
+     * @return true always - it always inserts
+     */
+    bool push_front(const ItemType &new_element);
+
+    /**
+     * @brief deletes the item at a position
+     *
+     * @param position indicating point of deletion
+     * @post item at position is deleted, if any. List order is retained
+     * @return true if there is an item at position to be deleted,
+     * @return false otherwise
+     */
+    bool remove(const size_t &position);
+
+    /**
+     * @brief deletes the last item
+     *
+     * @post the last item is deleted, if any. List order is retained
+     * @return true if there is an item to be deleted,
+     * @return false otherwise
+     */
+    bool pop_back();
+
+    /**
+     * @brief deletes the first item
+     *
+     * @post the first item is deleted, if any. List order is retained
+     * @return true if there is an item to be deleted,
+     * @return false otherwise
+     */
+    bool pop_front();
+
+    /**
+     * @brief deletes all items in the list and item_count_ is set to 0
+     *
+     * @post the node array is kept for reuse - compact() frees it
+     */
+    void clear();
+
+    /**
+     * @brief prints the contents of the list
+     *
+     * @note the items are written in large blocks, and std::cout is flushed once at the end
+     */
+    void display();
+
+    /**
+     * @brief writes the contents of the list to a stream, separated by spaces and ending in a newline
+     *
+     * @param out the stream to write to - it is written in large blocks and never flushed
+     */
+    void display(std::ostream &out) const;
+
+    /**
+     * @brief writes the contents of the list into a writer, separated by spaces and ending in a newline
+     *
+     * @param writer to write to - nothing reaches its sink until it fills up or is flushed
+     */
+    void display(BufferedWriter &writer) const;
+
+    /**
+     * @brief swaps the items at positions i and j (i must be less than j)
+     *
+     * @pre i < j
+     * @param i is the index (integer) of the first item we are swapping in the list
+     * @param j is the index (integer) of the second item we are swapping in the list
+     * @post swaps the element at position i with the element at position j
+     */
+    void swap(const int &i, const int &j);
+
+    /**
+     * @brief lays the nodes out again in list order, in an array just big enough to hold them
+     *
+     * @post the freelist is empty and walking the list reads the array from front to back
+     * @note takes O(n). If moving an item throws, the list is left untouched
+     */
+    void compact();
+
+    /**
+     * @brief gets the number of nodes the array has room for
+     *
+     * @return the capacity of the node array
+     */
+    size_t getCapacity() const;
+
+    /**
+     * @brief gets the memory resource the list allocates its node array from
+     *
+     * @return a pointer to the memory resource
+     */
+    std::pmr::memory_resource *getMemoryResource() const;
+
+private:
+    // Marks the end of a chain - it is never a valid index
+    static constexpr std::uint32_t NIL_ = UINT32_MAX;
+
+    /**
+     * @brief a node in the array - while on the freelist, it holds no item and next links the freelist
+     */
+    struct Slot
+    {
+        std::uint32_t next;
+        std::uint32_t prev;
+        alignas(ItemType) unsigned char storage[sizeof(ItemType)];
+
+        /**
+         * @brief gets the node's item
+         *
+         * @return a pointer to the item
+         */
+        ItemType *item();
+    };
+
+    Slot *slots_;
+    std::uint32_t capacity_;
+    // Slots from used_ on have never held an item, and are handed out once the freelist is empty
+    std::uint32_t used_;
+    std::uint32_t free_;
+    std::uint32_t first_;
+    std::uint32_t last_;
+    size_t item_count_;
+    std::pmr::memory_resource *memory_resource_;
+
+    /**
+     * @brief finds the node at a position, walking from whichever end of the list is nearer
+     *
+     * @pre position < item_count_
+     * @param position of the node
+     * @return the index of the node
+     */
+    std::uint32_t locate(const size_t &position) const;
+
+    /**
+     * @brief takes a slot off the freelist, or from the unused end of the array, growing the array if it is full
+     *
+     * @note growing the array lays the nodes out again, so indices found before the call are stale after it
+     * @return the index of the slot
+     */
+    std::uint32_t takeSlot();
+
+    /**
+     * @brief moves the items, in list order, into the front of a new array and frees the old one
+     *
+     * @pre item_count_ <= new_capacity
+     * @param new_capacity the number of slots in the new array
+     * @note if moving an item throws, the list is left untouched
+     */
+    void relayout(const std::uint32_t &new_capacity);
+
+    /**
+     * @brief appends copies of every item of a_list
+     *
+     * @param a_list to be copied
+     */
+    void copyFrom(const CompactLinkedList<ItemType> &a_list);
+};
+
+#include "CompactLinkedList.cpp"
+#endif
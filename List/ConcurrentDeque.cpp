@@ -0,0 +1,269 @@
+/**
+ * @file ConcurrentDeque.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Implementation for ConcurrentDeque class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "ConcurrentDeque.hpp"
+
+/**
+ * @brief default constructor
+ */
+template <class ItemType>
+ConcurrentDeque<ItemType>::ConcurrentDeque() : head_{nullptr, &tail_}, tail_{&head_, nullptr}, item_count_{0}
+{
+}
+
+/**
+ * @brief destructor - destroys every item and frees every node
+ *
+ * @pre no other thread is using the deque
+ */
+template <class ItemType>
+ConcurrentDeque<ItemType>::~ConcurrentDeque()
+{
+    clear();
+}
+
+/**
+ * @brief checks if the deque is empty
+ *
+ * @return true if no item is in the deque right now,
+ * @return false otherwise
+ */
+template <class ItemType>
+bool ConcurrentDeque<ItemType>::isEmpty() const
+{
+    return item_count_.load() == 0;
+}
+
+/**
+ * @brief gets the length of the deque
+ *
+ * @return the number of items in the deque, which other threads may change at any moment
+ */
+template <class ItemType>
+size_t ConcurrentDeque<ItemType>::getLength() const
+{
+    return item_count_.load();
+}
+
+/**
+ * @brief inserts an item at the front of the deque - safe to call from any number of threads at once
+ *
+ * @param new_element to be inserted in the deque
+ * @return true always - it always inserts
+ */
+template <class ItemType>
+bool ConcurrentDeque<ItemType>::push_front(const ItemType &new_element)
+{
+    pushNode(std::make_unique<DequeNode>(new_element), true);
+    return true;
+}
+
+/**
+ * @brief moves an item to the front of the deque - safe to call from any number of threads at once
+ *
+ * @param new_element to be moved into the deque
+ * @return true always - it always inserts
+ */
+template <class ItemType>
+bool ConcurrentDeque<ItemType>::push_front(ItemType &&new_element)
+{
+    pushNode(std::make_unique<DequeNode>(std::move(new_element)), true);
+    return true;
+}
+
+/**
+ * @brief inserts an item at the back of the deque - safe to call from any number of threads at once
+ *
+ * @param new_element to be inserted in the deque
+ * @return true always - it always inserts
+ */
+template <class ItemType>
+bool ConcurrentDeque<ItemType>::push_back(const ItemType &new_element)
+{
+    pushNode(std::make_unique<DequeNode>(new_element), false);
+    return true;
+}
+
+/**
+ * @brief moves an item to the back of the deque - safe to call from any number of threads at once
+ *
+ * @param new_element to be moved into the deque
+ * @return true always - it always inserts
+ */
+template <class ItemType>
+bool ConcurrentDeque<ItemType>::push_back(ItemType &&new_element)
+{
+    pushNode(std::make_unique<DequeNode>(std::move(new_element)), false);
+    return true;
+}
+
+/**
+ * @brief removes the first item - safe to call from any number of threads at once
+ *
+ * @param item set to the removed item
+ * @return true if there was an item to be removed,
+ * @return false if the deque was empty, leaving item untouched
+ */
+template <class ItemType>
+bool ConcurrentDeque<ItemType>::pop_front(ItemType &item)
+{
+    std::unique_ptr<DequeNode> node = popNode(true);
+    if (node == nullptr)
+    {
+        return false;
+    }
+    item = std::move(node->item);
+    return true;
+}
+
+/**
+ * @brief removes the last item - safe to call from any number of threads at once
+ *
+ * @param item set to the removed item
+ * @return true if there was an item to be removed,
+ * @return false if the deque was empty, leaving item untouched
+ */
+template <class ItemType>
+bool ConcurrentDeque<ItemType>::pop_back(ItemType &item)
+{
+    std::unique_ptr<DequeNode> node = popNode(false);
+    if (node == nullptr)
+    {
+        return false;
+    }
+    item = std::move(node->item);
+    return true;
+}
+
+/**
+ * @brief deletes all items in the deque
+ *
+ * @pre no other thread is using the deque
+ */
+template <class ItemType>
+void ConcurrentDeque<ItemType>::clear()
+{
+    Link *link = head_.next;
+    while (link != &tail_)
+    {
+        Link *next = link->next;
+        delete static_cast<DequeNode *>(link);
+        link = next;
+    }
+    head_.next = &tail_;
+    tail_.prev = &head_;
+    item_count_.store(0);
+}
+
+//********* PRIVATE METHODS **************//
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param an_item to be held by the node
+ */
+template <class ItemType>
+template <class Item>
+ConcurrentDeque<ItemType>::DequeNode::DequeNode(Item &&an_item) : Link{nullptr, nullptr}, item(std::forward<Item>(an_item))
+{
+}
+
+/**
+ * @brief links a node in at one end, taking just that end's lock while the deque is not empty
+ *
+ * @param node to be linked in
+ * @param at_front true to link it in first, false to link it in last
+ */
+template <class ItemType>
+void ConcurrentDeque<ItemType>::pushNode(std::unique_ptr<DequeNode> node, const bool &at_front)
+{
+    {
+        // With an item in between, the two ends touch different links. The other end cannot empty the deque meanwhile,
+        // since it would need this end's lock to take the last items
+        std::lock_guard<std::mutex> end_lock(at_front ? head_mutex_ : tail_mutex_);
+        if (item_count_.load() > 0)
+        {
+            link(node.release(), at_front);
+            item_count_.fetch_add(1);
+            return;
+        }
+    }
+
+    std::scoped_lock both_locks(head_mutex_, tail_mutex_);
+    link(node.release(), at_front);
+    item_count_.fetch_add(1);
+}
+
+/**
+ * @brief unlinks the node at one end, taking just that end's lock while the deque holds at least three items
+ *
+ * @param from_front true to unlink the first node, false to unlink the last one
+ * @return the unlinked node, or nullptr if the deque was empty
+ */
+template <class ItemType>
+std::unique_ptr<typename ConcurrentDeque<ItemType>::DequeNode> ConcurrentDeque<ItemType>::popNode(const bool &from_front)
+{
+    {
+        // Claiming a node only while three are unclaimed leaves two between the ends, even if the other end claims one
+        // too - so the two pops never touch the same link
+        std::lock_guard<std::mutex> end_lock(from_front ? head_mutex_ : tail_mutex_);
+        size_t count = item_count_.load();
+        while (count >= 3)
+        {
+            if (item_count_.compare_exchange_weak(count, count - 1))
+            {
+                return std::unique_ptr<DequeNode>(unlink(from_front));
+            }
+        }
+    }
+
+    std::scoped_lock both_locks(head_mutex_, tail_mutex_);
+    if (item_count_.load() == 0)
+    {
+        return std::unique_ptr<DequeNode>(nullptr);
+    }
+    item_count_.fetch_sub(1);
+    return std::unique_ptr<DequeNode>(unlink(from_front));
+}
+
+/**
+ * @brief links a node in at one end
+ *
+ * @pre the caller holds that end's lock, and both locks if the deque is empty
+ * @param node to be linked in
+ * @param at_front true to link it in first, false to link it in last
+ */
+template <class ItemType>
+void ConcurrentDeque<ItemType>::link(DequeNode *node, const bool &at_front)
+{
+    Link *previous = at_front ? &head_ : tail_.prev;
+    Link *next = previous->next;
+    node->prev = previous;
+    node->next = next;
+    next->prev = node;
+    previous->next = node;
+}
+
+/**
+ * @brief unlinks the node at one end
+ *
+ * @pre the caller has claimed the node by decrementing item_count_, and holds the locks it needs
+ * @param from_front true to unlink the first node, false to unlink the last one
+ * @return the unlinked node
+ */
+template <class ItemType>
+typename ConcurrentDeque<ItemType>::DequeNode *ConcurrentDeque<ItemType>::unlink(const bool &from_front)
+{
+    Link *node = from_front ? head_.next : tail_.prev;
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    return static_cast<DequeNode *>(node);
+}
@@ -0,0 +1,190 @@
+/**
+ * @file ConcurrentDeque.hpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Interface for ConcurrentDeque class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef CONCURRENT_DEQUE_
+#define CONCURRENT_DEQUE_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+/**
+ * @brief A doubly linked deque that any number of threads can push to and pop from at both ends at once
+ *
+ * @note Each end has its own lock, so a thread working at the front never waits for one working at the back. Only
+ * while the deque holds too few items for the two ends to stay apart does an operation take both locks
+ * @note A popped node is unlinked under its end's lock before it is freed, and nothing else walks the chain, so no
+ * other thread can still be reading it - no hazard pointers or epochs are needed
+ */
+template <class ItemType>
+class ConcurrentDeque
+{
+public:
+    /**
+     * @brief default constructor
+     */
+    ConcurrentDeque();
+
+    ConcurrentDeque(const ConcurrentDeque<ItemType> &a_deque) = delete;
+    ConcurrentDeque<ItemType> &operator=(const ConcurrentDeque<ItemType> &a_deque) = delete;
+
+    /**
+     * @brief destructor - destroys every item and frees every node
+     *
+     * @pre no other thread is using the deque
+     */
+    ~ConcurrentDeque();
+
+    /**
+     * @brief checks if the deque is empty
+     *
+     * @return true if no item is in the deque right now,
+     * @return false otherwise
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief gets the length of the deque
+     *
+     * @return the number of items in the deque, which other threads may change at any moment
+     */
+    size_t getLength() const;
+
+    /**
+     * @brief inserts an item at the front of the deque - safe to call from any number of threads at once
+     *
+     * @param new_element to be inserted in the deque
+     * @return true always - it always inserts
+     */
+    bool push_front(const ItemType &new_element);
+
+    /**
+     * @brief moves an item to the front of the deque - safe to call from any number of threads at once
+     *
+     * @param new_element to be moved into the deque
+     * @return true always - it always inserts
+     */
+    bool push_front(ItemType &&new_element);
+
+    /**
+     * @brief inserts an item at the back of the deque - safe to call from any number of threads at once
+     *
+     * @param new_element to be inserted in the deque
+     * @return true always - it always inserts
+     */
+    bool push_back(const ItemType &new_element);
+
+    /**
+     * @brief moves an item to the back of the deque - safe to call from any number of threads at once
+     *
+     * @param new_element to be moved into the deque
+     * @return true always - it always inserts
+     */
+    bool push_back(ItemType &&new_element);
+
+    /**
+     * @brief removes the first item - safe to call from any number of threads at once
+     *
+     * @param item set to the removed item
+     * @return true if there was an item to be removed,
+     * @return false if the deque was empty, leaving item untouched
+     */
+    bool pop_front(ItemType &item);
+
+    /**
+     * @brief removes the last item - safe to call from any number of threads at once
+     *
+     * @param item set to the removed item
+     * @return true if there was an item to be removed,
+     * @return false if the deque was empty, leaving item untouched
+     */
+    bool pop_back(ItemType &item);
+
+    /**
+     * @brief deletes all items in the deque
+     *
+     * @pre no other thread is using the deque
+     */
+    void clear();
+
+private:
+    /**
+     * @brief the links shared by the nodes and the two sentinels
+     */
+    struct Link
+    {
+        Link *prev;
+        Link *next;
+    };
+
+    /**
+     * @brief a node holding one item
+     */
+    struct DequeNode : Link
+    {
+        /**
+         * @brief parameterized constructor
+         *
+         * @param an_item to be held by the node
+         */
+        template <class Item>
+        explicit DequeNode(Item &&an_item);
+
+        ItemType item;
+    };
+
+    // Each end's sentinel and lock share a cache line of their own
+    alignas(64) std::mutex head_mutex_;
+    Link head_;
+    alignas(64) std::mutex tail_mutex_;
+    Link tail_;
+
+    // The number of linked items not yet claimed by a pop
+    alignas(64) std::atomic<size_t> item_count_;
+
+    /**
+     * @brief links a node in at one end, taking just that end's lock while the deque is not empty
+     *
+     * @param node to be linked in
+     * @param at_front true to link it in first, false to link it in last
+     */
+    void pushNode(std::unique_ptr<DequeNode> node, const bool &at_front);
+
+    /**
+     * @brief unlinks the node at one end, taking just that end's lock while the deque holds at least three items
+     *
+     * @param from_front true to unlink the first node, false to unlink the last one
+     * @return the unlinked node, or nullptr if the deque was empty
+     */
+    std::unique_ptr<DequeNode> popNode(const bool &from_front);
+
+    /**
+     * @brief links a node in at one end
+     *
+     * @pre the caller holds that end's lock, and both locks if the deque is empty
+     * @param node to be linked in
+     * @param at_front true to link it in first, false to link it in last
+     */
+    void link(DequeNode *node, const bool &at_front);
+
+    /**
+     * @brief unlinks the node at one end
+     *
+     * @pre the caller has claimed the node by decrementing item_count_, and holds the locks it needs
+     * @param from_front true to unlink the first node, false to unlink the last one
+     * @return the unlinked node
+     */
+    DequeNode *unlink(const bool &from_front);
+};
+
+#include "ConcurrentDeque.cpp"
+#endif
@@ -18,7 +18,25 @@
 template <class ItemType>
 DoublyLinkedList<ItemType>::DoublyLinkedList() : item_count_{0},
                                                  first_{std::shared_ptr<Node<ItemType>>(nullptr)},
-                                                 last_{std::shared_ptr<Node<ItemType>>(nullptr)}
+                                                 last_{std::shared_ptr<Node<ItemType>>(nullptr)},
+                                                 memory_resource_{std::pmr::get_default_resource()},
+                                                 cursor_position_{0},
+                                                 node_pool_{nullptr}
+{
+}
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param memory_resource to allocate the node pool's blocks from
+ */
+template <class ItemType>
+DoublyLinkedList<ItemType>::DoublyLinkedList(std::pmr::memory_resource *memory_resource) : first_{std::shared_ptr<Node<ItemType>>(nullptr)},
+                                                                                          last_{std::shared_ptr<Node<ItemType>>(nullptr)},
+                                                                                          item_count_{0},
+                                                                                          memory_resource_{memory_resource},
+                                                                                          cursor_position_{0},
+                                                                                          node_pool_{nullptr}
 {
 }
 
@@ -26,10 +44,12 @@ DoublyLinkedList<ItemType>::DoublyLinkedList() : item_count_{0},
  * @brief copy constructor
  *
  * @param a_list to be copied
+ * @note the copy gets its own node pool, backed by the same memory resource as a_list
  */
 template <class ItemType>
-DoublyLinkedList<ItemType>::DoublyLinkedList(const DoublyLinkedList<ItemType> &a_list)
+DoublyLinkedList<ItemType>::DoublyLinkedList(const DoublyLinkedList<ItemType> &a_list) : DoublyLinkedList(a_list.memory_resource_)
 {
+    // Delegating first means the destructor frees the copied nodes and the pool if copying an item throws
     item_count_ = a_list.item_count_;
     std::shared_ptr<Node<ItemType>> orig_chain_ptr = a_list.first_;
 
@@ -41,9 +61,8 @@ DoublyLinkedList<ItemType>::DoublyLinkedList(const DoublyLinkedList<ItemType> &a
     else
     {
         // Copy first node
-        first_ = std::make_shared<Node<ItemType>>();
+        first_ = makeNode(orig_chain_ptr->getItem());
         first_->setPrevious(std::shared_ptr<Node<ItemType>>(nullptr));
-        first_->setItem(orig_chain_ptr->getItem());
 
         // Copy remaining nodes
         std::shared_ptr<Node<ItemType>> new_chain_ptr = first_; // Points to last node in new chain
@@ -51,11 +70,8 @@ DoublyLinkedList<ItemType>::DoublyLinkedList(const DoublyLinkedList<ItemType> &a
 
         while (orig_chain_ptr != nullptr)
         {
-            // Get next item from original chain
-            ItemType next_item = orig_chain_ptr->getItem();
-
-            // Create a new node containing the next item
-            std::shared_ptr<Node<ItemType>> new_node_ptr = std::make_shared<Node<ItemType>>(next_item);
+            // Create a new node containing the next item from original chain
+            std::shared_ptr<Node<ItemType>> new_node_ptr = makeNode(orig_chain_ptr->getItem());
 
             // Link new node to end of new chain
             new_chain_ptr->setNext(new_node_ptr);
@@ -74,6 +90,90 @@ DoublyLinkedList<ItemType>::DoublyLinkedList(const DoublyLinkedList<ItemType> &a
     }
 }
 
+/**
+ * @brief move constructor
+ *
+ * @param a_list to be moved - it is left empty
+ * @note takes over a_list's nodes and node pool in O(1) - a_list gets a new pool if it is used again
+ */
+template <class ItemType>
+DoublyLinkedList<ItemType>::DoublyLinkedList(DoublyLinkedList<ItemType> &&a_list) noexcept : first_{std::move(a_list.first_)},
+                                                                                           last_{std::move(a_list.last_)},
+                                                                                           item_count_{a_list.item_count_},
+                                                                                           memory_resource_{a_list.memory_resource_},
+                                                                                           cursor_{std::move(a_list.cursor_)},
+                                                                                           cursor_position_{a_list.cursor_position_},
+                                                                                           node_pool_{a_list.node_pool_}
+{
+    a_list.item_count_ = 0;
+    a_list.node_pool_ = nullptr;
+}
+
+/**
+ * @brief destructor - frees every node, one at a time, and lets go of the node pool
+ */
+template <class ItemType>
+DoublyLinkedList<ItemType>::~DoublyLinkedList()
+{
+    clear();
+    if (node_pool_ != nullptr)
+    {
+        node_pool_->abandon();
+    }
+}
+
+/**
+ * @brief copy assignment operator
+ *
+ * @param a_list to be copied
+ * @return a reference to this list
+ */
+template <class ItemType>
+DoublyLinkedList<ItemType> &DoublyLinkedList<ItemType>::operator=(const DoublyLinkedList<ItemType> &a_list)
+{
+    if (this != &a_list)
+    {
+        // Copy first so that this list is left untouched if copying throws, then take over the copied chain
+        DoublyLinkedList<ItemType> copy(a_list);
+        clear();
+        std::swap(first_, copy.first_);
+        std::swap(last_, copy.last_);
+        std::swap(item_count_, copy.item_count_);
+
+        // The copied nodes live in the copy's pool, so take that over too, along with the resource backing it
+        std::swap(node_pool_, copy.node_pool_);
+        std::swap(memory_resource_, copy.memory_resource_);
+    }
+    return *this;
+}
+
+/**
+ * @brief move assignment operator
+ *
+ * @param a_list to be moved - it is left empty
+ * @note takes over a_list's nodes and node pool in O(1), and hands this list's pool to a_list
+ * @return a reference to this list
+ */
+template <class ItemType>
+DoublyLinkedList<ItemType> &DoublyLinkedList<ItemType>::operator=(DoublyLinkedList<ItemType> &&a_list) noexcept
+{
+    if (this != &a_list)
+    {
+        clear();
+        first_ = std::move(a_list.first_);
+        last_ = std::move(a_list.last_);
+        item_count_ = a_list.item_count_;
+        cursor_ = std::move(a_list.cursor_);
+        cursor_position_ = a_list.cursor_position_;
+        a_list.item_count_ = 0;
+
+        // The nodes stay in the pool they came from, so take that pool over and let a_list allocate from this one
+        std::swap(node_pool_, a_list.node_pool_);
+        std::swap(memory_resource_, a_list.memory_resource_);
+    }
+    return *this;
+}
+
 /**
  * @brief checks if the list is empty
  *
@@ -102,15 +202,39 @@ size_t DoublyLinkedList<ItemType>::getLength() const
  *
  * @pre 0 <= position < item_count_
  * @param position of the item to be retrieved
- * @return the item at position in list if there is one, otherwise it throws exception: PrecondViolatedExcep
+ * @note leaves the cursor where it is, so that const readers may share the list - walk a const list in order with
+ * its iterators rather than by position
+ * @return a read-only reference to the item at position in list if there is one, valid until its node is deleted,
+ * otherwise it throws exception: PrecondViolatedExcep
+ */
+template <class ItemType>
+const ItemType &DoublyLinkedList<ItemType>::getItem(const size_t &position) const
+{
+    if (position < item_count_)
+    {
+        return findNode(position)->getItem();
+    }
+    else
+    {
+        throw std::runtime_error("PrecondViolatedExcep");
+    }
+}
+
+/**
+ * @brief gets the item at a position
+ *
+ * @pre 0 <= position < item_count_
+ * @param position of the item to be retrieved
+ * @note moves the cursor to position, so stepping through the positions in order costs O(1) each
+ * @return a reference to the item at position in list if there is one, valid until its node is deleted,
+ * otherwise it throws exception: PrecondViolatedExcep
  */
 template <class ItemType>
-ItemType DoublyLinkedList<ItemType>::getItem(const size_t &position) const
+ItemType &DoublyLinkedList<ItemType>::getItem(const size_t &position)
 {
-    if (0 <= position && position < item_count_)
+    if (position < item_count_)
     {
-        std::shared_ptr<Node<ItemType>> pos_ptr = getPointerTo(position);
-        return pos_ptr->getItem();
+        return moveCursorTo(position)->getItemReference();
     }
     else
     {
@@ -122,6 +246,9 @@ ItemType DoublyLinkedList<ItemType>::getItem(const size_t &position) const
  * @brief gets the pointer to node at a position
  *
  * @param position of node
+ * @note walks from whichever of the head, the tail or the cursor left by the last non-const access is nearest,
+ * without touching a reference count until the node is reached
+ * @note reads the cursor but never moves it, so const calls on one list may run on several threads at once
  * @return pointer to a node,
  * @return std::shared_ptr<Node<ItemType>>(nullptr) if position > item_count_
  */
@@ -130,13 +257,7 @@ std::shared_ptr<Node<ItemType>> DoublyLinkedList<ItemType>::getPointerTo(const s
 {
     if (position < item_count_)
     {
-        std::shared_ptr<Node<ItemType>> find = std::make_shared<Node<ItemType>>();
-        find = first_;
-        for (size_t i = 0; i < position; i++)
-        {
-            find = find->getNext();
-        }
-        return find;
+        return findNode(position)->shared_from_this();
     }
     else
     {
@@ -177,51 +298,99 @@ std::shared_ptr<Node<ItemType>> DoublyLinkedList<ItemType>::getTailNode() const
 template <class ItemType>
 bool DoublyLinkedList<ItemType>::insert(const size_t &position, const ItemType &new_element)
 {
-    // Create a new node containing the new entry and get a pointer to position
-    std::shared_ptr<Node<ItemType>> new_node_ptr = std::make_shared<Node<ItemType>>(new_element);
-    std::shared_ptr<Node<ItemType>> pos_ptr = getPointerTo(position);
+    return insertNode(position, makeNode(new_element));
+}
 
-    // Attach new node to chain
-    if (first_ == nullptr)
-    {
-        // Chain is empty - insert first node
-        new_node_ptr->setNext(std::shared_ptr<Node<ItemType>>(nullptr));
-        new_node_ptr->setPrevious(nullptr);
-        first_ = new_node_ptr;
-        last_ = new_node_ptr;
-    }
-    else if (pos_ptr == first_)
-    {
-        // Insert new node at beginning of list
-        new_node_ptr->setNext(first_);
-        new_node_ptr->setPrevious(std::shared_ptr<Node<ItemType>>(nullptr));
-        first_->setPrevious(new_node_ptr);
-        first_ = new_node_ptr;
-    }
-    else if (pos_ptr == nullptr)
-    {
-        // Insert at end of list
-        new_node_ptr->setNext(std::shared_ptr<Node<ItemType>>(nullptr));
-        new_node_ptr->setPrevious(last_);
-        last_->setNext(new_node_ptr);
-        last_ = new_node_ptr;
-    }
-    else
+/**
+ * @brief moves an item into the list at a position
+ *
+ * @param position indicating point of insertion
+ * @param new_element to be moved into the list
+ * @post new_element is added at position in list (the node previously at that position is now at position+1)
+ * @return true always - it always inserts, if position > item_count_, then it inserts at end of list
+ */
+template <class ItemType>
+bool DoublyLinkedList<ItemType>::insert(const size_t &position, ItemType &&new_element)
+{
+    return insertNode(position, makeNode(std::move(new_element)));
+}
+
+/**
+ * @brief inserts copies of the items in [first, last) at a position, walking to the position once
+ *
+ * @param position indicating point of insertion
+ * @param first iterator to the first item to be inserted
+ * @param last iterator past the last item to be inserted
+ * @post the items are added in order at position in list (the node previously at that position follows them)
+ * @note the new nodes are linked to each other first and then linked in as one chain, so the list is left
+ * untouched if copying an item throws
+ * @return true always - it always inserts, if position > item_count_, then it inserts at end of list
+ */
+template <class ItemType>
+template <class InputIt>
+bool DoublyLinkedList<ItemType>::insert(const size_t &position, InputIt first, InputIt last)
+{
+    std::shared_ptr<Node<ItemType>> chain_first(nullptr);
+    std::shared_ptr<Node<ItemType>> chain_last(nullptr);
+    size_t inserted = makeChain(first, last, chain_first, chain_last);
+    if (inserted == 0)
     {
-        // Insert new node before node to which pos_ptr points to
-        new_node_ptr->setNext(pos_ptr);
-        new_node_ptr->setPrevious(pos_ptr->getPrevious());
-        pos_ptr->getPrevious()->setNext(new_node_ptr);
-        pos_ptr->setPrevious(new_node_ptr);
+        return true;
     }
 
-    // Increase count of entries
-    item_count_++;
+    size_t start = std::min(position, item_count_);
+    linkBefore(start < item_count_ ? findNode(start) : nullptr, chain_first, chain_last.get());
+    item_count_ += inserted;
 
-    // It will always insert
+    // The cursor moves to the last new node, which keeps loading batch after batch in order cheap
+    cursor_ = chain_last;
+    cursor_position_ = start + inserted - 1;
     return true;
 }
 
+/**
+ * @brief constructs an item in place at a position
+ *
+ * @param position indicating point of insertion - if position > item_count_, then it inserts at end of list
+ * @param args to be forwarded to the constructor of ItemType
+ * @return a reference to the new item
+ */
+template <class ItemType>
+template <class... Args>
+ItemType &DoublyLinkedList<ItemType>::emplace(const size_t &position, Args &&...args)
+{
+    std::shared_ptr<Node<ItemType>> new_node_ptr = makeNode(std::in_place, std::forward<Args>(args)...);
+    insertNode(position, new_node_ptr);
+    return new_node_ptr->getItemReference();
+}
+
+/**
+ * @brief constructs an item in place at the end of the list
+ *
+ * @param args to be forwarded to the constructor of ItemType
+ * @return a reference to the new item
+ */
+template <class ItemType>
+template <class... Args>
+ItemType &DoublyLinkedList<ItemType>::emplace_back(Args &&...args)
+{
+    return emplace(item_count_, std::forward<Args>(args)...);
+}
+
+/**
+ * @brief constructs an item in place at the front of the list
+ *
+ * @param args to be forwarded to the constructor of ItemType
+ * @return a reference to the new item
+ */
+template <class ItemType>
+template <class... Args>
+ItemType &DoublyLinkedList<ItemType>::emplace_front(Args &&...args)
+{
+    return emplace(0, std::forward<Args>(args)...);
+}
+
+
 /**
  * @brief inserts an item at the end of the list
  *
@@ -235,6 +404,19 @@ bool DoublyLinkedList<ItemType>::push_back(const ItemType &new_element)
     return insert(item_count_, new_element);
 }
 
+/**
+ * @brief moves an item to the end of the list
+ *
+ * @param new_element to be moved into the list
+ * @post new_element is added at the end of the list
+ * @return true always - it always inserts
+ */
+template <class ItemType>
+bool DoublyLinkedList<ItemType>::push_back(ItemType &&new_element)
+{
+    return insert(item_count_, std::move(new_element));
+}
+
 /**
  * @brief inserts an item at the front of the list
  *
@@ -248,6 +430,19 @@ bool DoublyLinkedList<ItemType>::push_front(const ItemType &new_element)
     return insert(0, new_element);
 }
 
+/**
+ * @brief moves an item to the front of the list
+ *
+ * @param new_element to be moved into the list
+ * @post new_element is added at the front of the list
+ * @return true always - it always inserts
+ */
+template <class ItemType>
+bool DoublyLinkedList<ItemType>::push_front(ItemType &&new_element)
+{
+    return insert(0, std::move(new_element));
+}
+
 /**
  * @brief deletes a node at a position
  *
@@ -303,6 +498,22 @@ bool DoublyLinkedList<ItemType>::remove(const size_t &position)
             // Deallocation not necessary since using smart pointers
         }
 
+        // The cursor moves to the node that takes position's place, or to the new last node
+        if (position == item_count_ - 1)
+        {
+            cursor_ = last_;
+            cursor_position_ = position - 1;
+        }
+        else
+        {
+            cursor_ = pos_ptr->getNext();
+            cursor_position_ = position;
+        }
+
+        // Cut the removed node loose, so that a caller still holding it is not left pointing into the list
+        pos_ptr->setNext(std::shared_ptr<Node<ItemType>>(nullptr));
+        pos_ptr->setPrevious(std::shared_ptr<Node<ItemType>>(nullptr));
+
         item_count_--;
         return true;
     }
@@ -334,8 +545,51 @@ bool DoublyLinkedList<ItemType>::pop_front()
     return remove(0);
 }
 
+/**
+ * @brief deletes every node whose item matches a predicate, in one pass
+ *
+ * @param pred called once on each item - a node is deleted if it returns true
+ * @post list order of the remaining nodes is retained
+ * @note each run of adjacent matches is unlinked in one step. If pred throws, the nodes deleted so far stay deleted
+ * @return the number of nodes deleted
+ */
+template <class ItemType>
+template <class Predicate>
+size_t DoublyLinkedList<ItemType>::remove_if(Predicate pred)
+{
+    cursor_ = nullptr;
+    size_t removed = 0;
+    Node<ItemType> *node = first_.get();
+    while (node != nullptr)
+    {
+        if (!pred(node->getItem()))
+        {
+            node = node->peekNext();
+            continue;
+        }
+
+        // Extend the run of matches as far as it goes, then unlink it in one step
+        Node<ItemType> *run_last = node;
+        size_t run_length = 1;
+        while (run_last->peekNext() != nullptr && pred(run_last->peekNext()->getItem()))
+        {
+            run_last = run_last->peekNext();
+            run_length++;
+        }
+
+        Node<ItemType> *following = run_last->peekNext();
+        freeChain(unlink(node, run_last));
+        item_count_ -= run_length;
+        removed += run_length;
+        node = following;
+    }
+    return removed;
+}
+
 /**
  * @brief deletes all nodes in the list and item_count_ is set to 0
+ *
+ * @post the nodes' blocks stay in the node pool, to be reused by the next insertions
  */
 template <class ItemType>
 void DoublyLinkedList<ItemType>::clear()
@@ -345,7 +599,7 @@ void DoublyLinkedList<ItemType>::clear()
     {
         first_ = first_->getNext();
 
-        // Return node to the system
+        // Return node to the system - cutting its next link first means freeing it never recurses down the chain
         node_to_delete->setNext(std::shared_ptr<Node<ItemType>>(nullptr));
         node_to_delete->setPrevious(std::shared_ptr<Node<ItemType>>(nullptr));
 
@@ -354,33 +608,47 @@ void DoublyLinkedList<ItemType>::clear()
     // head_ is nullptr; node_to_delete is nullptr
     last_ = nullptr;
     item_count_ = 0;
+    cursor_ = nullptr;
 }
 
 /**
  * @brief prints the contents of the list
  *
+ * @note the items are written in large blocks, and std::cout is flushed once at the end
  */
 template <class ItemType>
 void DoublyLinkedList<ItemType>::display()
 {
-    if (getLength() == 0)
-    {
-        return;
-    }
-    std::shared_ptr<Node<ItemType>> iterator = first_;
-    while (iterator != std::shared_ptr<Node<ItemType>>(nullptr))
+    display(std::cout);
+    std::cout.flush();
+}
+
+/**
+ * @brief writes the contents of the list to a stream, separated by spaces and ending in a newline
+ *
+ * @param out the stream to write to - it is written in large blocks and never flushed
+ */
+template <class ItemType>
+void DoublyLinkedList<ItemType>::display(std::ostream &out) const
+{
+    BufferedWriter writer(out);
+    display(writer);
+    writer.flush();
+}
+
+/**
+ * @brief writes the contents of the list into a writer, separated by spaces and ending in a newline
+ *
+ * @param writer to write to - nothing reaches its sink until it fills up or is flushed
+ */
+template <class ItemType>
+void DoublyLinkedList<ItemType>::display(BufferedWriter &writer) const
+{
+    for (Node<ItemType> *node = first_.get(); node != nullptr; node = node->peekNext())
     {
-        if (iterator->getNext() == nullptr)
-        {
-            std::cout << iterator->getItem() << std::endl;
-        }
-        else
-        {
-            std::cout << iterator->getItem() << " ";
-        }
-        iterator = iterator->getNext();
+        writer.write(node->getItem());
+        writer.put(node->peekNext() == nullptr ? '\n' : ' ');
     }
-    return;
 }
 
 /**
@@ -400,10 +668,831 @@ void DoublyLinkedList<ItemType>::swap(const int &i, const int &j)
         std::shared_ptr<Node<ItemType>> first = getPointerTo(i);
         std::shared_ptr<Node<ItemType>> second = getPointerTo(j);
 
-        ItemType first_item = first->getItem();
-        ItemType second_item = second->getItem();
-
-        first->setItem(second_item);
-        second->setItem(first_item);
+        // Swap the items in place, without copying either
+        using std::swap;
+        swap(first->getItemReference(), second->getItemReference());
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief gets an iterator to the first node
+ *
+ * @return an iterator to the first node, or end() if the list is empty
+ */
+template <class ItemType>
+typename DoublyLinkedList<ItemType>::iterator DoublyLinkedList<ItemType>::begin()
+{
+    return iterator(first_.get(), this);
+}
+
+/**
+ * @brief gets an iterator past the last node
+ *
+ * @return an iterator past the last node
+ */
+template <class ItemType>
+typename DoublyLinkedList<ItemType>::iterator DoublyLinkedList<ItemType>::end()
+{
+    return iterator(nullptr, this);
+}
+
+/**
+ * @brief gets a read-only iterator to the first node
+ *
+ * @return an iterator to the first node, or end() if the list is empty
+ */
+template <class ItemType>
+typename DoublyLinkedList<ItemType>::const_iterator DoublyLinkedList<ItemType>::begin() const
+{
+    return const_iterator(first_.get(), this);
+}
+
+/**
+ * @brief gets a read-only iterator past the last node
+ *
+ * @return an iterator past the last node
+ */
+template <class ItemType>
+typename DoublyLinkedList<ItemType>::const_iterator DoublyLinkedList<ItemType>::end() const
+{
+    return const_iterator(nullptr, this);
+}
+
+/**
+ * @brief gets a read-only iterator to the first node
+ *
+ * @return an iterator to the first node, or cend() if the list is empty
+ */
+template <class ItemType>
+typename DoublyLinkedList<ItemType>::const_iterator DoublyLinkedList<ItemType>::cbegin() const
+{
+    return begin();
+}
+
+/**
+ * @brief gets a read-only iterator past the last node
+ *
+ * @return an iterator past the last node
+ */
+template <class ItemType>
+typename DoublyLinkedList<ItemType>::const_iterator DoublyLinkedList<ItemType>::cend() const
+{
+    return end();
+}
+
+/**
+ * @brief inserts an item before an iterator in O(1)
+ *
+ * @param position before which new_element is inserted - end() appends it
+ * @param new_element to be inserted in list
+ * @return an iterator to the new node
+ */
+template <class ItemType>
+typename DoublyLinkedList<ItemType>::iterator DoublyLinkedList<ItemType>::insert(const_iterator position, const ItemType &new_element)
+{
+    std::shared_ptr<Node<ItemType>> new_node_ptr = makeNode(new_element);
+    linkBefore(position.node_, new_node_ptr, new_node_ptr.get());
+    item_count_++;
+
+    // The new node's position is unknown without a walk, so the cursor is dropped
+    cursor_ = nullptr;
+    return iterator(new_node_ptr.get(), this);
+}
+
+/**
+ * @brief inserts copies of the items in [first, last) before an iterator
+ *
+ * @param position before which the items are inserted - end() appends them
+ * @param first iterator to the first item to be inserted
+ * @param last iterator past the last item to be inserted
+ * @note the list is left untouched if copying an item throws
+ * @return an iterator to the first new node, or position if [first, last) is empty
+ */
+template <class ItemType>
+template <class InputIt>
+typename DoublyLinkedList<ItemType>::iterator DoublyLinkedList<ItemType>::insert(const_iterator position, InputIt first, InputIt last)
+{
+    std::shared_ptr<Node<ItemType>> chain_first(nullptr);
+    std::shared_ptr<Node<ItemType>> chain_last(nullptr);
+    size_t inserted = makeChain(first, last, chain_first, chain_last);
+    if (inserted == 0)
+    {
+        return iterator(position.node_, this);
+    }
+
+    linkBefore(position.node_, chain_first, chain_last.get());
+    item_count_ += inserted;
+
+    // The new nodes' positions are unknown without a walk, so the cursor is dropped
+    cursor_ = nullptr;
+    return iterator(chain_first.get(), this);
+}
+
+/**
+ * @brief deletes the node an iterator points to in O(1)
+ *
+ * @param position of the node to be deleted - must not be end()
+ * @post only iterators to the deleted node are invalidated
+ * @return an iterator to the node that followed the deleted one
+ */
+template <class ItemType>
+typename DoublyLinkedList<ItemType>::iterator DoublyLinkedList<ItemType>::erase(const_iterator position)
+{
+    Node<ItemType> *following = position.node_->peekNext();
+    cursor_ = nullptr;
+    unlink(position.node_, position.node_);
+    item_count_--;
+    return iterator(following, this);
+}
+
+/**
+ * @brief deletes every node in [first, last)
+ *
+ * @param first iterator to the first node to be deleted
+ * @param last iterator past the last node to be deleted
+ * @return last
+ */
+template <class ItemType>
+typename DoublyLinkedList<ItemType>::iterator DoublyLinkedList<ItemType>::erase(const_iterator first, const_iterator last)
+{
+    if (first != last)
+    {
+        Node<ItemType> *chain_last = last.node_ == nullptr ? last_.get() : last.node_->peekPrevious();
+        size_t removed = 1;
+        for (Node<ItemType> *node = first.node_; node != chain_last; node = node->peekNext())
+        {
+            removed++;
+        }
+
+        // The detached chain is freed as it goes out of scope
+        cursor_ = nullptr;
+        unlink(first.node_, chain_last);
+        item_count_ -= removed;
+    }
+    return iterator(last.node_, this);
+}
+
+/**
+ * @brief moves every node of other into this list before position in O(1), without copying or reallocating
+ *
+ * @param position before which the nodes are inserted
+ * @param other the list to take the nodes from - it is left empty
+ * @post iterators to the moved nodes stay valid and now walk this list - only an end() reached from them must
+ * not be decremented, see ListIterator
+ */
+template <class ItemType>
+void DoublyLinkedList<ItemType>::splice(const_iterator position, DoublyLinkedList<ItemType> &other)
+{
+    if (&other == this || other.first_ == nullptr)
+    {
+        return;
+    }
+
+    size_t moved = other.item_count_;
+    Node<ItemType> *chain_last = other.last_.get();
+    std::shared_ptr<Node<ItemType>> chain_first = other.unlink(other.first_.get(), chain_last);
+    linkBefore(position.node_, chain_first, chain_last);
+
+    other.item_count_ = 0;
+    other.cursor_ = nullptr;
+    item_count_ += moved;
+    cursor_ = nullptr;
+}
+
+/**
+ * @brief moves a single node of other into this list before position in O(1), without copying or reallocating
+ *
+ * @param position before which the node is inserted
+ * @param other the list the node belongs to - may be this list
+ * @param it iterator to the node to be moved
+ * @post iterators to the moved node stay valid and now walk this list - only an end() reached from them must
+ * not be decremented, see ListIterator
+ */
+template <class ItemType>
+void DoublyLinkedList<ItemType>::splice(const_iterator position, DoublyLinkedList<ItemType> &other, const_iterator it)
+{
+    // Moving a node in front of itself or of its successor leaves the list as it is
+    if (&other == this && (position.node_ == it.node_ || position.node_ == it.node_->peekNext()))
+    {
+        return;
+    }
+
+    std::shared_ptr<Node<ItemType>> node_ptr = other.unlink(it.node_, it.node_);
+    linkBefore(position.node_, node_ptr, node_ptr.get());
+
+    other.item_count_--;
+    other.cursor_ = nullptr;
+    item_count_++;
+    cursor_ = nullptr;
+}
+
+/**
+ * @brief moves the nodes in [first, last) of other into this list before position, without copying or reallocating
+ *
+ * @pre position is not in [first, last)
+ * @param position before which the nodes are inserted
+ * @param other the list the nodes belong to - may be this list
+ * @param first iterator to the first node to be moved
+ * @param last iterator past the last node to be moved
+ * @post iterators to the moved nodes stay valid and now walk this list - only an end() reached from them must
+ * not be decremented, see ListIterator
+ * @note relinking takes O(1), but when other is a different list the moved nodes are counted in O(k)
+ */
+template <class ItemType>
+void DoublyLinkedList<ItemType>::splice(const_iterator position, DoublyLinkedList<ItemType> &other, const_iterator first, const_iterator last)
+{
+    // Iterators compare by node alone, so position only matches last when both are in this list
+    if (first == last || (&other == this && position == last))
+    {
+        return;
+    }
+
+    Node<ItemType> *chain_last = last.node_ == nullptr ? other.last_.get() : last.node_->peekPrevious();
+    size_t moved = 0;
+    if (&other != this)
+    {
+        moved = 1;
+        for (Node<ItemType> *node = first.node_; node != chain_last; node = node->peekNext())
+        {
+            moved++;
+        }
+    }
+
+    std::shared_ptr<Node<ItemType>> chain_first = other.unlink(first.node_, chain_last);
+    linkBefore(position.node_, chain_first, chain_last);
+
+    other.item_count_ -= moved;
+    other.cursor_ = nullptr;
+    item_count_ += moved;
+    cursor_ = nullptr;
+}
+
+/**
+ * @brief sorts the list with a stable merge sort that relinks nodes instead of copying items
+ *
+ * @param comp strict weak ordering - comp(a, b) is true if a goes before b
+ * @post equal items keep their relative order, and iterators stay valid, following their nodes
+ * @note takes O(n log n) comparisons and O(1) extra memory. If comp throws, every item is still in the list, in an
+ * unspecified order
+ */
+template <class ItemType>
+template <class Compare>
+void DoublyLinkedList<ItemType>::sort(Compare comp)
+{
+    if (item_count_ < 2)
+    {
+        return;
+    }
+
+    // Sort the nodes as a singly linked chain, then restore the previous links in one pass
+    std::shared_ptr<Node<ItemType>> chain = std::move(first_);
+    try
+    {
+        sortChain(chain, comp);
+    }
+    catch (...)
+    {
+        relink(chain);
+        throw;
+    }
+    relink(chain);
+}
+
+/**
+ * @brief sorts the list like sort(), splitting it into sublists that are sorted and then merged on several threads
+ *
+ * @param comp strict weak ordering - it is called from several threads at once
+ * @param thread_count the most threads to use, or 0 to use one per hardware thread
+ * @post equal items keep their relative order, and iterators stay valid, following their nodes
+ * @note falls back to sort() when the list is too short to be worth splitting. If comp throws, every item is still
+ * in the list, in an unspecified order
+ */
+template <class ItemType>
+template <class Compare>
+void DoublyLinkedList<ItemType>::parallelSort(Compare comp, const size_t &thread_count)
+{
+    size_t chain_count = thread_count != 0 ? thread_count : std::thread::hardware_concurrency();
+    chain_count = std::min(chain_count, item_count_ / PARALLEL_SORT_MIN_CHUNK_);
+    if (chain_count < 2)
+    {
+        sort(comp);
+        return;
+    }
+
+    // Cut the list into one chain per thread, the last one taking the remainder
+    std::vector<std::shared_ptr<Node<ItemType>>> chains(chain_count);
+    chains[0] = std::move(first_);
+    size_t chain_length = item_count_ / chain_count;
+    for (size_t i = 1; i < chain_count; i++)
+    {
+        Node<ItemType> *chain_last = chains[i - 1].get();
+        for (size_t j = 1; j < chain_length; j++)
+        {
+            chain_last = chain_last->peekNext();
+        }
+        chains[i] = chain_last->getNext();
+        chain_last->setNext(std::shared_ptr<Node<ItemType>>(nullptr));
+    }
+
+    // Sort every chain at once, then merge neighbouring chains pairwise, halving their number each round. Each task
+    // works on chains of its own, and sorting neither allocates nor frees a node, so the tasks share nothing
+    auto sort_task = [&chains, &comp](const size_t &i)
+    {
+        sortChain(chains[i], comp);
+    };
+    std::exception_ptr error(nullptr);
+    try
+    {
+        TaskRunner::run(chain_count, sort_task);
+        for (size_t step = 1; step < chain_count; step *= 2)
+        {
+            auto merge_task = [&chains, &comp, step](const size_t &i)
+            {
+                mergeChains(chains[2 * step * i], chains[2 * step * i + step], comp);
+            };
+            TaskRunner::run((chain_count + step - 1) / (2 * step), merge_task);
+        }
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    // Every node is in one of the chains even if a task threw, so gather them all back into the list
+    for (size_t i = 1; i < chain_count; i++)
+    {
+        appendChain(chains[0], chains[i]);
+    }
+    relink(chains[0]);
+    if (error != nullptr)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * @brief gets the memory resource the list's node pool allocates its blocks from
+ *
+ * @return a pointer to the memory resource
+ */
+template <class ItemType>
+std::pmr::memory_resource *DoublyLinkedList<ItemType>::getMemoryResource() const
+{
+    return memory_resource_;
+}
+
+/**
+ * @brief gets the pool the list allocates its nodes from
+ *
+ * @return a pointer to the node pool, or nullptr if the list has made no node yet, or none since it was moved from
+ */
+template <class ItemType>
+NodePool *DoublyLinkedList<ItemType>::getNodePool() const
+{
+    return node_pool_;
+}
+
+//********* PRIVATE METHODS **************//
+
+/**
+ * @brief finds the node at a position
+ *
+ * @pre position < item_count_
+ * @param position of node
+ * @note walks the raw links from whichever of the head, the tail or the cursor is nearest
+ * @return a pointer to the node
+ */
+template <class ItemType>
+Node<ItemType> *DoublyLinkedList<ItemType>::findNode(const size_t &position) const
+{
+    // Start from the head or the tail, whichever is nearer
+    Node<ItemType> *find = first_.get();
+    size_t find_position = 0;
+    size_t distance = position;
+    if (item_count_ - 1 - position < distance)
+    {
+        find = last_.get();
+        find_position = item_count_ - 1;
+        distance = item_count_ - 1 - position;
+    }
+
+    // The cursor wins if it is nearer still
+    if (cursor_ != nullptr)
+    {
+        size_t cursor_distance = cursor_position_ < position ? position - cursor_position_ : cursor_position_ - position;
+        if (cursor_distance < distance)
+        {
+            find = cursor_.get();
+            find_position = cursor_position_;
+        }
+    }
+
+    for (; find_position < position; find_position++)
+    {
+        find = find->peekNext();
+    }
+    for (; find_position > position; find_position--)
+    {
+        find = find->peekPrevious();
+    }
+    return find;
+}
+
+/**
+ * @brief finds the node at a position and moves the cursor to it
+ *
+ * @pre position < item_count_
+ * @param position of node
+ * @return a pointer to the node
+ */
+template <class ItemType>
+Node<ItemType> *DoublyLinkedList<ItemType>::moveCursorTo(const size_t &position)
+{
+    Node<ItemType> *find = findNode(position);
+    cursor_ = find->shared_from_this();
+    cursor_position_ = position;
+    return find;
+}
+
+/**
+ * @brief allocates a new unlinked node (and its control block) from node_pool_
+ *
+ * @param args to be forwarded to the constructor of Node
+ * @return a pointer to the new node
+ */
+template <class ItemType>
+template <class... Args>
+std::shared_ptr<Node<ItemType>> DoublyLinkedList<ItemType>::makeNode(Args &&...args)
+{
+    // The pool is made with the first node - and again after a move took it away
+    if (node_pool_ == nullptr)
+    {
+        node_pool_ = NodePool::create(memory_resource_);
+    }
+    return std::allocate_shared<Node<ItemType>>(NodeAllocator<Node<ItemType>>(node_pool_), std::forward<Args>(args)...);
+}
+
+/**
+ * @brief links a new node in at a position
+ *
+ * @param position indicating point of insertion - if position > item_count_, then it inserts at end of list
+ * @param new_node_ptr to be linked in
+ * @return true always - it always inserts
+ */
+template <class ItemType>
+bool DoublyLinkedList<ItemType>::insertNode(const size_t &position, const std::shared_ptr<Node<ItemType>> &new_node_ptr)
+{
+    // Get a pointer to position
+    std::shared_ptr<Node<ItemType>> pos_ptr = getPointerTo(position);
+
+    // Attach new node to chain
+    if (first_ == nullptr)
+    {
+        // Chain is empty - insert first node
+        new_node_ptr->setNext(std::shared_ptr<Node<ItemType>>(nullptr));
+        new_node_ptr->setPrevious(nullptr);
+        first_ = new_node_ptr;
+        last_ = new_node_ptr;
+    }
+    else if (pos_ptr == first_)
+    {
+        // Insert new node at beginning of list
+        new_node_ptr->setNext(first_);
+        new_node_ptr->setPrevious(std::shared_ptr<Node<ItemType>>(nullptr));
+        first_->setPrevious(new_node_ptr);
+        first_ = new_node_ptr;
+    }
+    else if (pos_ptr == nullptr)
+    {
+        // Insert at end of list
+        new_node_ptr->setNext(std::shared_ptr<Node<ItemType>>(nullptr));
+        new_node_ptr->setPrevious(last_);
+        last_->setNext(new_node_ptr);
+        last_ = new_node_ptr;
+    }
+    else
+    {
+        // Insert new node before node to which pos_ptr points to
+        new_node_ptr->setNext(pos_ptr);
+        new_node_ptr->setPrevious(pos_ptr->getPrevious());
+        pos_ptr->getPrevious()->setNext(new_node_ptr);
+        pos_ptr->setPrevious(new_node_ptr);
+    }
+
+    // Increase count of entries
+    item_count_++;
+
+    // The cursor moves to the new node, which keeps sequential inserts cheap
+    cursor_ = new_node_ptr;
+    cursor_position_ = std::min(position, item_count_ - 1);
+
+    // It will always insert
+    return true;
+}
+
+/**
+ * @brief links a detached chain into the list before position
+ *
+ * @param position before which the chain is linked, or nullptr to append it
+ * @param chain_first owning pointer to the first node of the chain
+ * @param chain_last the last node of the chain
+ * @note item_count_ is left for the caller to update
+ */
+template <class ItemType>
+void DoublyLinkedList<ItemType>::linkBefore(Node<ItemType> *position, const std::shared_ptr<Node<ItemType>> &chain_first, Node<ItemType> *chain_last)
+{
+    Node<ItemType> *previous = position == nullptr ? last_.get() : position->peekPrevious();
+    std::shared_ptr<Node<ItemType>> chain_last_ptr = chain_last->shared_from_this();
+
+    // Attach the far end first, so that position is always owned by some link
+    if (position == nullptr)
+    {
+        chain_last->setNext(std::shared_ptr<Node<ItemType>>(nullptr));
+        last_ = chain_last_ptr;
+    }
+    else
+    {
+        chain_last->setNext(position->shared_from_this());
+        position->setPrevious(chain_last_ptr);
+    }
+
+    if (previous == nullptr)
+    {
+        chain_first->setPrevious(std::shared_ptr<Node<ItemType>>(nullptr));
+        first_ = chain_first;
+    }
+    else
+    {
+        chain_first->setPrevious(previous->shared_from_this());
+        previous->setNext(chain_first);
+    }
+}
+
+/**
+ * @brief unlinks the nodes from chain_first to chain_last (inclusive) and returns them as a detached chain
+ *
+ * @param chain_first the first node to be unlinked
+ * @param chain_last the last node to be unlinked
+ * @note item_count_ is left for the caller to update
+ * @return an owning pointer to the first node of the detached chain
+ */
+template <class ItemType>
+std::shared_ptr<Node<ItemType>> DoublyLinkedList<ItemType>::unlink(Node<ItemType> *chain_first, Node<ItemType> *chain_last)
+{
+    std::shared_ptr<Node<ItemType>> chain_first_ptr = chain_first->shared_from_this();
+    std::shared_ptr<Node<ItemType>> previous = chain_first->getPrevious();
+    std::shared_ptr<Node<ItemType>> following = chain_last->getNext();
+
+    if (following == nullptr)
+    {
+        last_ = previous;
+    }
+    else
+    {
+        following->setPrevious(previous);
+    }
+
+    if (previous == nullptr)
+    {
+        first_ = following;
+    }
+    else
+    {
+        previous->setNext(following);
+    }
+
+    chain_first->setPrevious(std::shared_ptr<Node<ItemType>>(nullptr));
+    chain_last->setNext(std::shared_ptr<Node<ItemType>>(nullptr));
+    return chain_first_ptr;
+}
+
+/**
+ * @brief allocates a node for each item in [first, last) and links them into a detached chain
+ *
+ * @param first iterator to the first item
+ * @param last iterator past the last item
+ * @param chain_first set to an owning pointer to the first node of the chain, or nullptr if there is none
+ * @param chain_last set to the last node of the chain
+ * @note if copying an item throws, the nodes made so far are freed
+ * @return the number of nodes in the chain
+ */
+template <class ItemType>
+template <class InputIt>
+size_t DoublyLinkedList<ItemType>::makeChain(InputIt first, InputIt last, std::shared_ptr<Node<ItemType>> &chain_first, std::shared_ptr<Node<ItemType>> &chain_last)
+{
+    size_t length = 0;
+    try
+    {
+        for (; first != last; ++first)
+        {
+            std::shared_ptr<Node<ItemType>> new_node_ptr = makeNode(*first);
+            if (chain_last == nullptr)
+            {
+                chain_first = new_node_ptr;
+            }
+            else
+            {
+                new_node_ptr->setPrevious(chain_last);
+                chain_last->setNext(new_node_ptr);
+            }
+            chain_last = new_node_ptr;
+            length++;
+        }
+    }
+    catch (...)
+    {
+        chain_last = nullptr;
+        freeChain(std::move(chain_first));
+        chain_first = nullptr;
+        throw;
+    }
+    return length;
+}
+
+/**
+ * @brief frees a detached chain one node at a time, so freeing a long chain never recurses down it
+ *
+ * @param chain owning pointer to the first node of the chain
+ */
+template <class ItemType>
+void DoublyLinkedList<ItemType>::freeChain(std::shared_ptr<Node<ItemType>> chain)
+{
+    while (chain != nullptr)
+    {
+        std::shared_ptr<Node<ItemType>> next = chain->getNext();
+        chain->setNext(std::shared_ptr<Node<ItemType>>(nullptr));
+        chain = std::move(next);
+    }
+}
+
+/**
+ * @brief makes a singly linked chain the list's contents, restoring the previous links and last_
+ *
+ * @param chain owning pointer to the first node of the chain, holding item_count_ nodes
+ */
+template <class ItemType>
+void DoublyLinkedList<ItemType>::relink(const std::shared_ptr<Node<ItemType>> &chain)
+{
+    first_ = chain;
+    std::shared_ptr<Node<ItemType>> previous(nullptr);
+    for (std::shared_ptr<Node<ItemType>> node = chain; node != nullptr; node = node->getNext())
+    {
+        node->setPrevious(previous);
+        previous = node;
+    }
+    last_ = previous;
+
+    // Nodes have moved between positions
+    cursor_ = nullptr;
+}
+
+/**
+ * @brief links a singly linked chain onto the end of another
+ *
+ * @param chain to be extended - it may be empty
+ * @param rest the chain to be linked on
+ */
+template <class ItemType>
+void DoublyLinkedList<ItemType>::appendChain(std::shared_ptr<Node<ItemType>> &chain, const std::shared_ptr<Node<ItemType>> &rest)
+{
+    if (chain == nullptr)
+    {
+        chain = rest;
+        return;
+    }
+
+    Node<ItemType> *chain_last = chain.get();
+    while (chain_last->peekNext() != nullptr)
+    {
+        chain_last = chain_last->peekNext();
+    }
+    chain_last->setNext(rest);
+}
+
+/**
+ * @brief merges two sorted singly linked chains, taking from first on ties
+ *
+ * @param first the chain whose nodes go first among equals - set to the merged chain
+ * @param second the other chain - left empty
+ * @param comp strict weak ordering
+ * @note if comp throws, first is set to a chain of every node and second is left empty
+ */
+template <class ItemType>
+template <class Compare>
+void DoublyLinkedList<ItemType>::mergeChains(std::shared_ptr<Node<ItemType>> &first, std::shared_ptr<Node<ItemType>> &second, Compare &comp)
+{
+    std::shared_ptr<Node<ItemType>> merged(nullptr);
+    Node<ItemType> *merged_last = nullptr;
+    try
+    {
+        while (first != nullptr && second != nullptr)
+        {
+            // Take from second only when its item is strictly less, so that equal items keep their order
+            std::shared_ptr<Node<ItemType>> &source = comp(second->getItem(), first->getItem()) ? second : first;
+
+            // The merged chain's last node still links to source's front, or to the other chain's front, which first
+            // or second keeps alive - so no node is dropped while relinking
+            if (merged_last == nullptr)
+            {
+                merged = source;
+            }
+            else if (merged_last->peekNext() != source.get())
+            {
+                merged_last->setNext(source);
+            }
+            merged_last = source.get();
+            source = merged_last->getNext();
+        }
+    }
+    catch (...)
+    {
+        // The merged nodes still lead on into the rest of the chain the last of them came from - append the other one
+        if (merged_last != nullptr)
+        {
+            std::shared_ptr<Node<ItemType>> other = merged_last->peekNext() == first.get() ? second : first;
+            first = merged;
+            appendChain(first, other);
+        }
+        else
+        {
+            appendChain(first, second);
+        }
+        second = nullptr;
+        throw;
+    }
+
+    if (merged_last != nullptr)
+    {
+        merged_last->setNext(first != nullptr ? first : second);
+        first = merged;
+    }
+    else
+    {
+        appendChain(first, second);
+    }
+    second = nullptr;
+}
+
+/**
+ * @brief sorts a singly linked chain with a bottom-up merge sort, in O(1) extra memory
+ *
+ * @param chain to be sorted - set to the sorted chain
+ * @param comp strict weak ordering
+ * @note if comp throws, chain is set to a chain of every node, in an unspecified order
+ */
+template <class ItemType>
+template <class Compare>
+void DoublyLinkedList<ItemType>::sortChain(std::shared_ptr<Node<ItemType>> &chain, Compare &comp)
+{
+    // Like the digits of a binary counter, bins[i] is either empty or a sorted chain of 2^i nodes, and a bin holds
+    // earlier nodes than every bin below it
+    std::shared_ptr<Node<ItemType>> bins[64];
+    std::shared_ptr<Node<ItemType>> carry(nullptr);
+    int bin_count = 0;
+    try
+    {
+        while (chain != nullptr)
+        {
+            // Take the next node off the front of the chain
+            carry = std::move(chain);
+            chain = carry->getNext();
+            carry->setNext(std::shared_ptr<Node<ItemType>>(nullptr));
+
+            // Carry it up through the full bins
+            int i = 0;
+            for (; i < bin_count && bins[i] != nullptr; i++)
+            {
+                mergeChains(bins[i], carry, comp);
+                carry = std::move(bins[i]);
+            }
+            bins[i] = std::move(carry);
+            if (i == bin_count)
+            {
+                bin_count++;
+            }
+        }
+
+        // Merge what is left in the bins, upwards so that earlier nodes stay first
+        for (int i = 1; i < bin_count; i++)
+        {
+            mergeChains(bins[i], bins[i - 1], comp);
+        }
+        if (bin_count > 0)
+        {
+            chain = std::move(bins[bin_count - 1]);
+        }
+    }
+    catch (...)
+    {
+        // Gather every node back into chain, so that none is lost
+        std::shared_ptr<Node<ItemType>> rest = std::move(chain);
+        chain = nullptr;
+        for (int i = 0; i < bin_count; i++)
+        {
+            appendChain(chain, bins[i]);
+        }
+        appendChain(chain, carry);
+        appendChain(chain, rest);
+        throw;
+    }
+}
@@ -14,26 +14,82 @@
 
 #include <iostream>
 #include <algorithm>
+#include <exception>
+#include <functional>
 #include <memory>
+#include <memory_resource>
+#include <thread>
+#include <utility>
+#include <vector>
 #include "../Node/Node.hpp"
+#include "../Node/NodePool.hpp"
+#include "../Output/BufferedWriter.hpp"
+#include "../Parallel/TaskRunner.hpp"
+#include "ListIterator.hpp"
 
 template <class ItemType>
 class DoublyLinkedList
 {
 public:
+    using value_type = ItemType;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = ItemType &;
+    using const_reference = const ItemType &;
+    using iterator = ListIterator<ItemType, false>;
+    using const_iterator = ListIterator<ItemType, true>;
+
     /**
      * @brief default constructor
      *
      */
     DoublyLinkedList();
 
+    /**
+     * @brief parameterized constructor
+     *
+     * @param memory_resource to allocate the node pool's blocks from
+     */
+    explicit DoublyLinkedList(std::pmr::memory_resource *memory_resource);
+
     /**
      * @brief copy constructor
      *
      * @param a_list to be copied
+     * @note the copy gets its own node pool, backed by the same memory resource as a_list
      */
     DoublyLinkedList(const DoublyLinkedList<ItemType> &a_list);
 
+    /**
+     * @brief move constructor
+     *
+     * @param a_list to be moved - it is left empty
+     * @note takes over a_list's nodes and node pool in O(1) - a_list gets a new pool if it is used again
+     */
+    DoublyLinkedList(DoublyLinkedList<ItemType> &&a_list) noexcept;
+
+    /**
+     * @brief destructor - frees every node, one at a time, and lets go of the node pool
+     */
+    ~DoublyLinkedList();
+
+    /**
+     * @brief copy assignment operator
+     *
+     * @param a_list to be copied
+     * @return a reference to this list
+     */
+    DoublyLinkedList<ItemType> &operator=(const DoublyLinkedList<ItemType> &a_list);
+
+    /**
+     * @brief move assignment operator
+     *
+     * @param a_list to be moved - it is left empty
+     * @note takes over a_list's nodes and node pool in O(1), and hands this list's pool to a_list
+     * @return a reference to this list
+     */
+    DoublyLinkedList<ItemType> &operator=(DoublyLinkedList<ItemType> &&a_list) noexcept;
+
     /**
      * @brief checks if the list is empty
      *
@@ -54,14 +110,31 @@ public:
      *
      * @pre 0 <= position < item_count_
      * @param position of the item to be retrieved
-     * @return the item at position in list if there is one, otherwise it throws exception: PrecondViolatedExcep
+     * @note leaves the cursor where it is, so that const readers may share the list - walk a const list in order with
+     * its iterators rather than by position
+     * @return a read-only reference to the item at position in list if there is one, valid until its node is deleted,
+     * otherwise it throws exception: PrecondViolatedExcep
      */
-    ItemType getItem(const size_t &position) const;
+    const ItemType &getItem(const size_t &position) const;
+
+    /**
+     * @brief gets the item at a position
+     *
+     * @pre 0 <= position < item_count_
+     * @param position of the item to be retrieved
+     * @note moves the cursor to position, so stepping through the positions in order costs O(1) each
+     * @return a reference to the item at position in list if there is one, valid until its node is deleted,
+     * otherwise it throws exception: PrecondViolatedExcep
+     */
+    ItemType &getItem(const size_t &position);
 
     /**
      * @brief gets the pointer to node at a position
      *
      * @param position of node
+     * @note walks from whichever of the head, the tail or the cursor left by the last non-const access is nearest,
+     * without touching a reference count until the node is reached
+     * @note reads the cursor but never moves it, so const calls on one list may run on several threads at once
      * @return pointer to a node,
      * @return std::shared_ptr<Node<ItemType>>(nullptr) if position > item_count_
      */
@@ -91,6 +164,58 @@ public:
      */
     bool insert(const size_t &position, const ItemType &new_element);
 
+    /**
+     * @brief moves an item into the list at a position
+     *
+     * @param position indicating point of insertion
+     * @param new_element to be moved into the list
+     * @post new_element is added at position in list (the node previously at that position is now at position+1)
+     * @return true always - it always inserts, if position > item_count_, then it inserts at end of list
+     */
+    bool insert(const size_t &position, ItemType &&new_element);
+
+    /**
+     * @brief inserts copies of the items in [first, last) at a position, walking to the position once
+     *
+     * @param position indicating point of insertion
+     * @param first iterator to the first item to be inserted
+     * @param last iterator past the last item to be inserted
+     * @post the items are added in order at position in list (the node previously at that position follows them)
+     * @note the new nodes are linked to each other first and then linked in as one chain, so the list is left
+     * untouched if copying an item throws
+     * @return true always - it always inserts, if position > item_count_, then it inserts at end of list
+     */
+    template <class InputIt>
+    bool insert(const size_t &position, InputIt first, InputIt last);
+
+    /**
+     * @brief constructs an item in place at a position
+     *
+     * @param position indicating point of insertion - if position > item_count_, then it inserts at end of list
+     * @param args to be forwarded to the constructor of ItemType
+     * @return a reference to the new item
+     */
+    template <class... Args>
+    ItemType &emplace(const size_t &position, Args &&...args);
+
+    /**
+     * @brief constructs an item in place at the end of the list
+     *
+     * @param args to be forwarded to the constructor of ItemType
+     * @return a reference to the new item
+     */
+    template <class... Args>
+    ItemType &emplace_back(Args &&...args);
+
+    /**
+     * @brief constructs an item in place at the front of the list
+     *
+     * @param args to be forwarded to the constructor of ItemType
+     * @return a reference to the new item
+     */
+    template <class... Args>
+    ItemType &emplace_front(Args &&...args);
+
     /**
      * @brief inserts an item at the end of the list
      *
@@ -100,6 +225,15 @@ public:
      */
     bool push_back(const ItemType &new_element);
 
+    /**
+     * @brief moves an item to the end of the list
+     *
+     * @param new_element to be moved into the list
+     * @post new_element is added at the end of the list
+     * @return true always - it always inserts
+     */
+    bool push_back(ItemType &&new_element);
+
     /**
      * @brief inserts an item at the front of the list
      *
@@ -109,6 +243,15 @@ public:
      */
     bool push_front(const ItemType &new_element);
 
+    /**
+     * @brief moves an item to the front of the list
+     *
+     * @param new_element to be moved into the list
+     * @post new_element is added at the front of the list
+     * @return true always - it always inserts
+     */
+    bool push_front(ItemType &&new_element);
+
     /**
      * @brief deletes a node at a position
      *
@@ -130,17 +273,45 @@ public:
 
     bool pop_front();
 
+    /**
+     * @brief deletes every node whose item matches a predicate, in one pass
+     *
+     * @param pred called once on each item - a node is deleted if it returns true
+     * @post list order of the remaining nodes is retained
+     * @note each run of adjacent matches is unlinked in one step. If pred throws, the nodes deleted so far stay deleted
+     * @return the number of nodes deleted
+     */
+    template <class Predicate>
+    size_t remove_if(Predicate pred);
+
     /**
      * @brief deletes all nodes in the list and item_count_ is set to 0
+     *
+     * @post the nodes' blocks stay in the node pool, to be reused by the next insertions
      */
     void clear();
 
     /**
      * @brief prints the contents of the list
      *
+     * @note the items are written in large blocks, and std::cout is flushed once at the end
      */
     void display();
 
+    /**
+     * @brief writes the contents of the list to a stream, separated by spaces and ending in a newline
+     *
+     * @param out the stream to write to - it is written in large blocks and never flushed
+     */
+    void display(std::ostream &out) const;
+
+    /**
+     * @brief writes the contents of the list into a writer, separated by spaces and ending in a newline
+     *
+     * @param writer to write to - nothing reaches its sink until it fills up or is flushed
+     */
+    void display(BufferedWriter &writer) const;
+
     /**
      * @brief swaps the nodes at positions i and j (i must be less than j)
      *
@@ -152,10 +323,293 @@ public:
      */
     void swap(const int &i, const int &j);
 
+    /**
+     * @brief gets an iterator to the first node
+     *
+     * @return an iterator to the first node, or end() if the list is empty
+     */
+    iterator begin();
+
+    /**
+     * @brief gets an iterator past the last node
+     *
+     * @return an iterator past the last node
+     */
+    iterator end();
+
+    /**
+     * @brief gets a read-only iterator to the first node
+     *
+     * @return an iterator to the first node, or end() if the list is empty
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief gets a read-only iterator past the last node
+     *
+     * @return an iterator past the last node
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief gets a read-only iterator to the first node
+     *
+     * @return an iterator to the first node, or cend() if the list is empty
+     */
+    const_iterator cbegin() const;
+
+    /**
+     * @brief gets a read-only iterator past the last node
+     *
+     * @return an iterator past the last node
+     */
+    const_iterator cend() const;
+
+    /**
+     * @brief inserts an item before an iterator in O(1)
+     *
+     * @param position before which new_element is inserted - end() appends it
+     * @param new_element to be inserted in list
+     * @return an iterator to the new node
+     */
+    iterator insert(const_iterator position, const ItemType &new_element);
+
+    /**
+     * @brief inserts copies of the items in [first, last) before an iterator
+     *
+     * @param position before which the items are inserted - end() appends them
+     * @param first iterator to the first item to be inserted
+     * @param last iterator past the last item to be inserted
+     * @note the list is left untouched if copying an item throws
+     * @return an iterator to the first new node, or position if [first, last) is empty
+     */
+    template <class InputIt>
+    iterator insert(const_iterator position, InputIt first, InputIt last);
+
+    /**
+     * @brief deletes the node an iterator points to in O(1)
+     *
+     * @param position of the node to be deleted - must not be end()
+     * @post only iterators to the deleted node are invalidated
+     * @return an iterator to the node that followed the deleted one
+     */
+    iterator erase(const_iterator position);
+
+    /**
+     * @brief deletes every node in [first, last)
+     *
+     * @param first iterator to the first node to be deleted
+     * @param last iterator past the last node to be deleted
+     * @return last
+     */
+    iterator erase(const_iterator first, const_iterator last);
+
+    /**
+     * @brief moves every node of other into this list before position in O(1), without copying or reallocating
+     *
+     * @param position before which the nodes are inserted
+     * @param other the list to take the nodes from - it is left empty
+     * @post iterators to the moved nodes stay valid and now walk this list - only an end() reached from them must
+     * not be decremented, see ListIterator
+     */
+    void splice(const_iterator position, DoublyLinkedList<ItemType> &other);
+
+    /**
+     * @brief moves a single node of other into this list before position in O(1), without copying or reallocating
+     *
+     * @param position before which the node is inserted
+     * @param other the list the node belongs to - may be this list
+     * @param it iterator to the node to be moved
+     * @post iterators to the moved node stay valid and now walk this list - only an end() reached from them must
+     * not be decremented, see ListIterator
+     */
+    void splice(const_iterator position, DoublyLinkedList<ItemType> &other, const_iterator it);
+
+    /**
+     * @brief moves the nodes in [first, last) of other into this list before position, without copying or reallocating
+     *
+     * @pre position is not in [first, last)
+     * @param position before which the nodes are inserted
+     * @param other the list the nodes belong to - may be this list
+     * @param first iterator to the first node to be moved
+     * @param last iterator past the last node to be moved
+     * @post iterators to the moved nodes stay valid and now walk this list - only an end() reached from them must
+     * not be decremented, see ListIterator
+     * @note relinking takes O(1), but when other is a different list the moved nodes are counted in O(k)
+     */
+    void splice(const_iterator position, DoublyLinkedList<ItemType> &other, const_iterator first, const_iterator last);
+
+    /**
+     * @brief sorts the list with a stable merge sort that relinks nodes instead of copying items
+     *
+     * @param comp strict weak ordering - comp(a, b) is true if a goes before b
+     * @post equal items keep their relative order, and iterators stay valid, following their nodes
+     * @note takes O(n log n) comparisons and O(1) extra memory. If comp throws, every item is still in the list, in an
+     * unspecified order
+     */
+    template <class Compare = std::less<ItemType>>
+    void sort(Compare comp = Compare());
+
+    /**
+     * @brief sorts the list like sort(), splitting it into sublists that are sorted and then merged on several threads
+     *
+     * @param comp strict weak ordering - it is called from several threads at once
+     * @param thread_count the most threads to use, or 0 to use one per hardware thread
+     * @post equal items keep their relative order, and iterators stay valid, following their nodes
+     * @note falls back to sort() when the list is too short to be worth splitting. If comp throws, every item is still
+     * in the list, in an unspecified order
+     */
+    template <class Compare = std::less<ItemType>>
+    void parallelSort(Compare comp = Compare(), const size_t &thread_count = 0);
+
+    /**
+     * @brief gets the memory resource the list's node pool allocates its blocks from
+     *
+     * @return a pointer to the memory resource
+     */
+    std::pmr::memory_resource *getMemoryResource() const;
+
+    /**
+     * @brief gets the pool the list allocates its nodes from
+     *
+     * @return a pointer to the node pool, or nullptr if the list has made no node yet, or none since it was moved from
+     */
+    NodePool *getNodePool() const;
+
 private:
     std::shared_ptr<Node<ItemType>> first_;
     std::shared_ptr<Node<ItemType>> last_;
     size_t item_count_;
+    std::pmr::memory_resource *memory_resource_;
+
+    // The last node reached by position through a non-const access, kept valid by insert() and remove() - empty if
+    // there is none. Const accesses only read it
+    std::shared_ptr<Node<ItemType>> cursor_;
+    size_t cursor_position_;
+
+    // Hands out nodes from contiguous chunks and reuses removed ones. Owned by the list, which abandons it on
+    // destruction - the pool itself stays alive until a node that outlives the list is freed. Made with the first node
+    NodePool *node_pool_;
+
+    // The fewest items worth handing to a sorting thread of their own
+    static constexpr size_t PARALLEL_SORT_MIN_CHUNK_ = 1 << 14;
+
+    // Stepping back from end() needs last_
+    friend class ListIterator<ItemType, false>;
+    friend class ListIterator<ItemType, true>;
+
+    /**
+     * @brief allocates a new unlinked node (and its control block) from node_pool_
+     *
+     * @param args to be forwarded to the constructor of Node
+     * @return a pointer to the new node
+     */
+    template <class... Args>
+    std::shared_ptr<Node<ItemType>> makeNode(Args &&...args);
+
+    /**
+     * @brief finds the node at a position
+     *
+     * @pre position < item_count_
+     * @param position of node
+     * @note walks the raw links from whichever of the head, the tail or the cursor is nearest
+     * @return a pointer to the node
+     */
+    Node<ItemType> *findNode(const size_t &position) const;
+
+    /**
+     * @brief finds the node at a position and moves the cursor to it
+     *
+     * @pre position < item_count_
+     * @param position of node
+     * @return a pointer to the node
+     */
+    Node<ItemType> *moveCursorTo(const size_t &position);
+
+    /**
+     * @brief links a new node in at a position
+     *
+     * @param position indicating point of insertion - if position > item_count_, then it inserts at end of list
+     * @param new_node_ptr to be linked in
+     * @return true always - it always inserts
+     */
+    bool insertNode(const size_t &position, const std::shared_ptr<Node<ItemType>> &new_node_ptr);
+
+    /**
+     * @brief links a detached chain into the list before position
+     *
+     * @param position before which the chain is linked, or nullptr to append it
+     * @param chain_first owning pointer to the first node of the chain
+     * @param chain_last the last node of the chain
+     * @note item_count_ is left for the caller to update
+     */
+    void linkBefore(Node<ItemType> *position, const std::shared_ptr<Node<ItemType>> &chain_first, Node<ItemType> *chain_last);
+
+    /**
+     * @brief unlinks the nodes from chain_first to chain_last (inclusive) and returns them as a detached chain
+     *
+     * @param chain_first the first node to be unlinked
+     * @param chain_last the last node to be unlinked
+     * @note item_count_ is left for the caller to update
+     * @return an owning pointer to the first node of the detached chain
+     */
+    std::shared_ptr<Node<ItemType>> unlink(Node<ItemType> *chain_first, Node<ItemType> *chain_last);
+
+    /**
+     * @brief allocates a node for each item in [first, last) and links them into a detached chain
+     *
+     * @param first iterator to the first item
+     * @param last iterator past the last item
+     * @param chain_first set to an owning pointer to the first node of the chain, or nullptr if there is none
+     * @param chain_last set to the last node of the chain
+     * @note if copying an item throws, the nodes made so far are freed
+     * @return the number of nodes in the chain
+     */
+    template <class InputIt>
+    size_t makeChain(InputIt first, InputIt last, std::shared_ptr<Node<ItemType>> &chain_first, std::shared_ptr<Node<ItemType>> &chain_last);
+
+    /**
+     * @brief frees a detached chain one node at a time, so freeing a long chain never recurses down it
+     *
+     * @param chain owning pointer to the first node of the chain
+     */
+    static void freeChain(std::shared_ptr<Node<ItemType>> chain);
+
+    /**
+     * @brief makes a singly linked chain the list's contents, restoring the previous links and last_
+     *
+     * @param chain owning pointer to the first node of the chain, holding item_count_ nodes
+     */
+    void relink(const std::shared_ptr<Node<ItemType>> &chain);
+
+    /**
+     * @brief links a singly linked chain onto the end of another
+     *
+     * @param chain to be extended - it may be empty
+     * @param rest the chain to be linked on
+     */
+    static void appendChain(std::shared_ptr<Node<ItemType>> &chain, const std::shared_ptr<Node<ItemType>> &rest);
+
+    /**
+     * @brief merges two sorted singly linked chains, taking from first on ties
+     *
+     * @param first the chain whose nodes go first among equals - set to the merged chain
+     * @param second the other chain - left empty
+     * @param comp strict weak ordering
+     * @note if comp throws, first is set to a chain of every node and second is left empty
+     */
+    template <class Compare>
+    static void mergeChains(std::shared_ptr<Node<ItemType>> &first, std::shared_ptr<Node<ItemType>> &second, Compare &comp);
+
+    /**
+     * @brief sorts a singly linked chain with a bottom-up merge sort, in O(1) extra memory
+     *
+     * @param chain to be sorted - set to the sorted chain
+     * @param comp strict weak ordering
+     * @note if comp throws, chain is set to a chain of every node, in an unspecified order
+     */
+    template <class Compare>
+    static void sortChain(std::shared_ptr<Node<ItemType>> &chain, Compare &comp);
 };
 
 #include "DoublyLinkedList.cpp"
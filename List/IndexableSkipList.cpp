@@ -0,0 +1,483 @@
+/**
+ * @file IndexableSkipList.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Implementation for IndexableSkipList class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "IndexableSkipList.hpp"
+
+/**
+ * @brief default constructor
+ */
+template <class ItemType>
+IndexableSkipList<ItemType>::IndexableSkipList() : IndexableSkipList(std::pmr::get_default_resource())
+{
+}
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param memory_resource to allocate every node from
+ */
+template <class ItemType>
+IndexableSkipList<ItemType>::IndexableSkipList(std::pmr::memory_resource *memory_resource) : level_{1},
+                                                                                            item_count_{0},
+                                                                                            memory_resource_{memory_resource},
+                                                                                            random_state_{0x9E3779B97F4A7C15ull}
+{
+    head_[0] = Link{nullptr, 1};
+}
+
+/**
+ * @brief copy constructor
+ *
+ * @param a_list to be copied
+ * @note the copy allocates its nodes from the same memory resource as a_list
+ */
+template <class ItemType>
+IndexableSkipList<ItemType>::IndexableSkipList(const IndexableSkipList<ItemType> &a_list) : IndexableSkipList(a_list.memory_resource_)
+{
+    for (SkipNode *node = a_list.head_[0].next; node != nullptr; node = node->links()[0].next)
+    {
+        push_back(node->item);
+    }
+}
+
+/**
+ * @brief destructor - destroys every item and frees every node
+ */
+template <class ItemType>
+IndexableSkipList<ItemType>::~IndexableSkipList()
+{
+    clear();
+}
+
+/**
+ * @brief copy assignment operator
+ *
+ * @param a_list to be copied
+ * @return a reference to this list
+ */
+template <class ItemType>
+IndexableSkipList<ItemType> &IndexableSkipList<ItemType>::operator=(const IndexableSkipList<ItemType> &a_list)
+{
+    if (this != &a_list)
+    {
+        // Copy first so that this list is left untouched if copying throws, then take over the copied nodes
+        IndexableSkipList<ItemType> copy(memory_resource_);
+        for (SkipNode *node = a_list.head_[0].next; node != nullptr; node = node->links()[0].next)
+        {
+            copy.push_back(node->item);
+        }
+        clear();
+        std::swap(head_, copy.head_);
+        std::swap(level_, copy.level_);
+        std::swap(item_count_, copy.item_count_);
+    }
+    return *this;
+}
+
+/**
+ * @brief checks if the list is empty
+ *
+ * @return true if the list is empty,
+ * @return false otherwise
+ */
+template <class ItemType>
+bool IndexableSkipList<ItemType>::isEmpty() const
+{
+    return item_count_ == 0;
+}
+
+/**
+ * @brief gets the length of the list
+ *
+ * @return the number of items in the list
+ */
+template <class ItemType>
+size_t IndexableSkipList<ItemType>::getLength() const
+{
+    return item_count_;
+}
+
+/**
+ * @brief gets the item at a position in O(log n)
+ *
+ * @pre 0 <= position < item_count_
+ * @param position of the item to be retrieved
+ * @return the item at position in list if there is one, otherwise it throws exception: PrecondViolatedExcep
+ */
+template <class ItemType>
+ItemType IndexableSkipList<ItemType>::getItem(const size_t &position) const
+{
+    if (position < item_count_)
+    {
+        return find(position)->item;
+    }
+    else
+    {
+        throw std::runtime_error("PrecondViolatedExcep");
+    }
+}
+
+/**
+ * @brief inserts an item at a position in O(log n)
+ *
+ * @param position indicating point of insertion
+ * @param new_element to be inserted in list
+ * @post new_element is added at position in list (the item previously at that position is now at position+1)
+ * @return true always - it always inserts, if position > item_count_, then it inserts at end of list
+ */
+template <class ItemType>
+bool IndexableSkipList<ItemType>::insert(const size_t &position, const ItemType &new_element)
+{
+    size_t target = position < item_count_ ? position : item_count_;
+    int node_level = randomLevel();
+    SkipNode *new_node = makeNode(new_element, node_level);
+
+    // A taller node than any before it starts new levels at the head, which span the whole list
+    for (; level_ < node_level; level_++)
+    {
+        head_[level_] = Link{nullptr, item_count_ + 1};
+    }
+
+    // Positions count from 1 here, with the head at 0 - on each level, stop at the last node before the new one
+    Link *links = head_;
+    size_t rank = 0;
+    for (int level = level_ - 1; level >= 0; level--)
+    {
+        while (links[level].next != nullptr && rank + links[level].span <= target)
+        {
+            rank += links[level].span;
+            links = links[level].next->links();
+        }
+
+        if (level < node_level)
+        {
+            // Split the link around the new node
+            Link *new_links = new_node->links();
+            new_links[level] = Link{links[level].next, links[level].span - (target - rank)};
+            links[level] = Link{new_node, target - rank + 1};
+        }
+        else
+        {
+            // The link jumps over the new node
+            links[level].span++;
+        }
+    }
+
+    item_count_++;
+    return true;
+}
+
+/**
+ * @brief inserts an item at the end of the list
+ *
+ * @param new_element to be inserted in list
+ * @post new_element is added at the end of the list
+ * @return true always - it always inserts
+ */
+template <class ItemType>
+bool IndexableSkipList<ItemType>::push_back(const ItemType &new_element)
+{
+    return insert(item_count_, new_element);
+}
+
+/**
+ * @brief inserts an item at the front of the list
+ *
+ * @param new_element to be inserted in list
+ * @post new_element is added at the front of the list
+ * @return true always - it always inserts
+ */
+template <class ItemType>
+bool IndexableSkipList<ItemType>::push_front(const ItemType &new_element)
+{
+    return insert(0, new_element);
+}
+
+/**
+ * @brief deletes the item at a position in O(log n)
+ *
+ * @param position indicating point of deletion
+ * @post item at position is deleted, if any. List order is retained
+ * @return true if there is an item at position to be deleted,
+ * @return false otherwise
+ */
+template <class ItemType>
+bool IndexableSkipList<ItemType>::remove(const size_t &position)
+{
+    if (position >= item_count_)
+    {
+        return false;
+    }
+
+    // On each level, stop at the last node before the one being removed
+    Link *links = head_;
+    size_t rank = 0;
+    SkipNode *target = nullptr;
+    for (int level = level_ - 1; level >= 0; level--)
+    {
+        while (links[level].next != nullptr && rank + links[level].span <= position)
+        {
+            rank += links[level].span;
+            links = links[level].next->links();
+        }
+
+        if (rank + links[level].span == position + 1 && links[level].next != nullptr)
+        {
+            // Bypass the node being removed
+            target = links[level].next;
+            Link &target_link = target->links()[level];
+            links[level] = Link{target_link.next, links[level].span + target_link.span - 1};
+        }
+        else
+        {
+            links[level].span--;
+        }
+    }
+
+    freeNode(target);
+    item_count_--;
+
+    // Drop levels left with nothing but the head
+    while (level_ > 1 && head_[level_ - 1].next == nullptr)
+    {
+        level_--;
+    }
+    return true;
+}
+
+/**
+ * @brief deletes the last item
+ *
+ * @post the last item is deleted, if any. List order is retained
+ * @return true if there is an item to be deleted,
+ * @return false otherwise
+ */
+template <class ItemType>
+bool IndexableSkipList<ItemType>::pop_back()
+{
+    return remove(item_count_ - 1);
+}
+
+/**
+ * @brief deletes the first item
+ *
+ * @post the first item is deleted, if any. List order is retained
+ * @return true if there is an item to be deleted,
+ * @return false otherwise
+ */
+template <class ItemType>
+bool IndexableSkipList<ItemType>::pop_front()
+{
+    return remove(0);
+}
+
+/**
+ * @brief deletes all items in the list and item_count_ is set to 0
+ */
+template <class ItemType>
+void IndexableSkipList<ItemType>::clear()
+{
+    SkipNode *node = head_[0].next;
+    while (node != nullptr)
+    {
+        SkipNode *next = node->links()[0].next;
+        freeNode(node);
+        node = next;
+    }
+    level_ = 1;
+    head_[0] = Link{nullptr, 1};
+    item_count_ = 0;
+}
+
+/**
+ * @brief prints the contents of the list
+ *
+ * @note the items are written in large blocks, and std::cout is flushed once at the end
+ */
+template <class ItemType>
+void IndexableSkipList<ItemType>::display()
+{
+    display(std::cout);
+    std::cout.flush();
+}
+
+/**
+ * @brief writes the contents of the list to a stream, separated by spaces and ending in a newline
+ *
+ * @param out the stream to write to - it is written in large blocks and never flushed
+ */
+template <class ItemType>
+void IndexableSkipList<ItemType>::display(std::ostream &out) const
+{
+    BufferedWriter writer(out);
+    display(writer);
+    writer.flush();
+}
+
+/**
+ * @brief writes the contents of the list into a writer, separated by spaces and ending in a newline
+ *
+ * @param writer to write to - nothing reaches its sink until it fills up or is flushed
+ */
+template <class ItemType>
+void IndexableSkipList<ItemType>::display(BufferedWriter &writer) const
+{
+    for (SkipNode *node = head_[0].next; node != nullptr; node = node->links()[0].next)
+    {
+        writer.write(node->item);
+        writer.put(node->links()[0].next == nullptr ? '\n' : ' ');
+    }
+}
+
+/**
+ * @brief swaps the items at positions i and j (i must be less than j)
+ *
+ * @pre i < j
+ * @param i is the index (integer) of the first item we are swapping in the list
+ * @param j is the index (integer) of the second item we are swapping in the list
+ * @post swaps the element at position i with the element at position j
+ */
+template <class ItemType>
+void IndexableSkipList<ItemType>::swap(const int &i, const int &j)
+{
+    if (0 <= i && i < j && static_cast<size_t>(j) < item_count_)
+    {
+        std::swap(find(i)->item, find(j)->item);
+    }
+}
+
+/**
+ * @brief gets the memory resource the list allocates its nodes from
+ *
+ * @return a pointer to the memory resource
+ */
+template <class ItemType>
+std::pmr::memory_resource *IndexableSkipList<ItemType>::getMemoryResource() const
+{
+    return memory_resource_;
+}
+
+//********* PRIVATE METHODS **************//
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param an_item to be held by the node
+ * @param node_level the number of links the node has
+ */
+template <class ItemType>
+IndexableSkipList<ItemType>::SkipNode::SkipNode(const ItemType &an_item, const int &node_level) : item{an_item}, level{node_level}
+{
+}
+
+/**
+ * @brief gets the node's links, lowest level first
+ *
+ * @return a pointer to the first link
+ */
+template <class ItemType>
+typename IndexableSkipList<ItemType>::Link *IndexableSkipList<ItemType>::SkipNode::links()
+{
+    return reinterpret_cast<Link *>(this + 1);
+}
+
+/**
+ * @brief finds the node at a position
+ *
+ * @pre position < item_count_
+ * @param position of the node
+ * @return the node
+ */
+template <class ItemType>
+typename IndexableSkipList<ItemType>::SkipNode *IndexableSkipList<ItemType>::find(const size_t &position) const
+{
+    const Link *links = head_;
+    SkipNode *node = nullptr;
+    size_t rank = 0;
+    for (int level = level_ - 1; level >= 0; level--)
+    {
+        while (links[level].next != nullptr && rank + links[level].span <= position + 1)
+        {
+            rank += links[level].span;
+            node = links[level].next;
+            links = node->links();
+        }
+        if (rank == position + 1)
+        {
+            break;
+        }
+    }
+    return node;
+}
+
+/**
+ * @brief draws the level of a new node - level k with probability (3/4) * (1/4)^(k-1)
+ *
+ * @return a level between 1 and MAX_LEVEL_
+ */
+template <class ItemType>
+int IndexableSkipList<ItemType>::randomLevel()
+{
+    // xorshift64 - the levels only need to be well spread, not unpredictable
+    random_state_ ^= random_state_ << 13;
+    random_state_ ^= random_state_ >> 7;
+    random_state_ ^= random_state_ << 17;
+
+    std::uint64_t bits = random_state_;
+    int level = 1;
+    while (level < MAX_LEVEL_ && (bits & 3) == 0)
+    {
+        level++;
+        bits >>= 2;
+    }
+    return level;
+}
+
+/**
+ * @brief allocates and constructs a node
+ *
+ * @param an_item to be held by the node
+ * @param node_level the number of links the node has
+ * @return the new node
+ */
+template <class ItemType>
+typename IndexableSkipList<ItemType>::SkipNode *IndexableSkipList<ItemType>::makeNode(const ItemType &an_item, const int &node_level)
+{
+    size_t bytes = sizeof(SkipNode) + sizeof(Link) * node_level;
+    void *storage = memory_resource_->allocate(bytes, alignof(SkipNode));
+    try
+    {
+        SkipNode *node = new (storage) SkipNode(an_item, node_level);
+        for (int level = 0; level < node_level; level++)
+        {
+            new (node->links() + level) Link{nullptr, 0};
+        }
+        return node;
+    }
+    catch (...)
+    {
+        memory_resource_->deallocate(storage, bytes, alignof(SkipNode));
+        throw;
+    }
+}
+
+/**
+ * @brief destroys and frees a node
+ *
+ * @param node to be freed
+ */
+template <class ItemType>
+void IndexableSkipList<ItemType>::freeNode(SkipNode *node)
+{
+    size_t bytes = sizeof(SkipNode) + sizeof(Link) * node->level;
+    node->~SkipNode();
+    memory_resource_->deallocate(node, bytes, alignof(SkipNode));
+}
@@ -0,0 +1,272 @@
+/**
+ * @file IndexableSkipList.hpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Interface for IndexableSkipList class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef INDEXABLE_SKIP_LIST_
+#define INDEXABLE_SKIP_LIST_
+
+#include <cstdint>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "../Output/BufferedWriter.hpp"
+
+/**
+ * @brief A sequence with the same interface as DoublyLinkedList, whose positional operations run in O(log n)
+ *
+ * @note A skip list kept in list order rather than sorted order - every link also records its span, the number of
+ * positions it jumps over, so a position is reached by summing spans on the way down instead of walking item by item
+ * @note getItem(), insert() and remove() all take expected O(log n) time, whatever the position
+ */
+template <class ItemType>
+class IndexableSkipList
+{
+public:
+    /**
+     * @brief default constructor
+     */
+    IndexableSkipList();
+
+    /**
+     * @brief parameterized constructor
+     *
+     * @param memory_resource to allocate every node from
+     */
+    explicit IndexableSkipList(std::pmr::memory_resource *memory_resource);
+
+    /**
+     * @brief copy constructor
+     *
+     * @param a_list to be copied
+     * @note the copy allocates its nodes from the same memory resource as a_list
+     */
+    IndexableSkipList(const IndexableSkipList<ItemType> &a_list);
+
+    /**
+     * @brief destructor - destroys every item and frees every node
+     */
+    ~IndexableSkipList();
+
+    /**
+     * @brief copy assignment operator
+     *
+     * @param a_list to be copied
+     * @return a reference to this list
+     */
+    IndexableSkipList<ItemType> &operator=(const IndexableSkipList<ItemType> &a_list);
+
+    /**
+     * @brief checks if the list is empty
+     *
+     * @return true if the list is empty,
+     * @return false otherwise
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief gets the length of the list
+     *
+     * @return the number of items in the list
+     */
+    size_t getLength() const;
+
+    /**
+     * @brief gets the item at a position in O(log n)
+     *
+     * @pre 0 <= position < item_count_
+     * @param position of the item to be retrieved
+     * @return the item at position in list if there is one, otherwise it throws exception: PrecondViolatedExcep
+     */
+    ItemType getItem(const size_t &position) const;
+
+    /**
+     * @brief inserts an item at a position in O(log n)
+     *
+     * @param position indicating point of insertion
+     * @param new_element to be inserted in list
+     * @post new_element is added at position in list (the item previously at that position is now at position+1)
+     * @return true always - it always inserts, if position > item_count_, then it inserts at end of list
+     */
+    bool insert(const size_t &position, const ItemType &new_element);
+
+    /**
+     * @brief inserts an item at the end of the list
+     *
+     * @param new_element to be inserted in list
+     * @post new_element is added at the end of the list
+     * @return true always - it always inserts
+     */
+    bool push_back(const ItemType &new_element);
+
+    /**
+     * @brief inserts an item at the front of the list
+     *
+     * @param new_element to be inserted in list
+     * @post new_element is added at the front of the list
+     * @return true always - it always inserts
+     */
+    bool push_front(const ItemType &new_element);
+
+    /**
+     * @brief deletes the item at a position in O(log n)
+     *
+     * @param position indicating point of deletion
+     * @post item at position is deleted, if any. List order is retained
+     * @return true if there is an item at position to be deleted,
+     * @return false otherwise
+     */
+    bool remove(const size_t &position);
+
+    /**
+     * @brief deletes the last item
+     *
+     * @post the last item is deleted, if any. List order is retained
+     * @return true if there is an item to be deleted,
+     * @return false otherwise
+     */
+    bool pop_back();
+
+    /**
+     * @brief deletes the first item
+     *
+     * @post the first item is deleted, if any. List order is retained
+     * @return true if there is an item to be deleted,
+     * @return false otherwise
+     */
+    bool pop_front();
+
+    /**
+     * @brief deletes all items in the list and item_count_ is set to 0
+     */
+    void clear();
+
+    /**
+     * @brief prints the contents of the list
+     *
+     * @note the items are written in large blocks, and std::cout is flushed once at the end
+     */
+    void display();
+
+    /**
+     * @brief writes the contents of the list to a stream, separated by spaces and ending in a newline
+     *
+     * @param out the stream to write to - it is written in large blocks and never flushed
+     */
+    void display(std::ostream &out) const;
+
+    /**
+     * @brief writes the contents of the list into a writer, separated by spaces and ending in a newline
+     *
+     * @param writer to write to - nothing reaches its sink until it fills up or is flushed
+     */
+    void display(BufferedWriter &writer) const;
+
+    /**
+     * @brief swaps the items at positions i and j (i must be less than j)
+     *
+     * @pre i < j
+     * @param i is the index (integer) of the first item we are swapping in the list
+     * @param j is the index (integer) of the second item we are swapping in the list
+     * @post swaps the element at position i with the element at position j
+     */
+    void swap(const int &i, const int &j);
+
+    /**
+     * @brief gets the memory resource the list allocates its nodes from
+     *
+     * @return a pointer to the memory resource
+     */
+    std::pmr::memory_resource *getMemoryResource() const;
+
+    // Each node is promoted to the next level with probability 1/4, so 32 levels cover far more items than fit in memory
+    static constexpr int MAX_LEVEL_ = 32;
+
+private:
+    struct SkipNode;
+
+    /**
+     * @brief a forward link at one level, and the number of positions it jumps over
+     *
+     * @note a link with no next node spans to one past the last item
+     */
+    struct Link
+    {
+        SkipNode *next;
+        size_t span;
+    };
+
+    /**
+     * @brief a node holding one item, followed in the same allocation by its level links
+     */
+    struct alignas(alignof(Link) > alignof(ItemType) ? alignof(Link) : alignof(ItemType)) SkipNode
+    {
+        /**
+         * @brief parameterized constructor
+         *
+         * @param an_item to be held by the node
+         * @param node_level the number of links the node has
+         */
+        SkipNode(const ItemType &an_item, const int &node_level);
+
+        /**
+         * @brief gets the node's links, lowest level first
+         *
+         * @return a pointer to the first link
+         */
+        Link *links();
+
+        ItemType item;
+        int level;
+    };
+
+    // The head's links - the head sits before the first item and holds no item of its own
+    Link head_[MAX_LEVEL_];
+    int level_;
+    size_t item_count_;
+    std::pmr::memory_resource *memory_resource_;
+    std::uint64_t random_state_;
+
+    /**
+     * @brief finds the node at a position
+     *
+     * @pre position < item_count_
+     * @param position of the node
+     * @return the node
+     */
+    SkipNode *find(const size_t &position) const;
+
+    /**
+     * @brief draws the level of a new node - level k with probability (3/4) * (1/4)^(k-1)
+     *
+     * @return a level between 1 and MAX_LEVEL_
+     */
+    int randomLevel();
+
+    /**
+     * @brief allocates and constructs a node
+     *
+     * @param an_item to be held by the node
+     * @param node_level the number of links the node has
+     * @return the new node
+     */
+    SkipNode *makeNode(const ItemType &an_item, const int &node_level);
+
+    /**
+     * @brief destroys and frees a node
+     *
+     * @param node to be freed
+     */
+    void freeNode(SkipNode *node);
+};
+
+#include "IndexableSkipList.cpp"
+#endif
@@ -0,0 +1,145 @@
+/**
+ * @file ListIterator.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Implementation for ListIterator class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "ListIterator.hpp"
+
+/**
+ * @brief default constructor - the iterator points nowhere until assigned
+ */
+template <class ItemType, bool IsConst>
+ListIterator<ItemType, IsConst>::ListIterator() : node_{nullptr}, list_{nullptr}
+{
+}
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param node to point to, or nullptr for the end of the list
+ * @param list the node belongs to
+ */
+template <class ItemType, bool IsConst>
+ListIterator<ItemType, IsConst>::ListIterator(Node<ItemType> *node, const DoublyLinkedList<ItemType> *list) : node_{node}, list_{list}
+{
+}
+
+/**
+ * @brief copy constructor - also turns an iterator into a read-only one
+ *
+ * @param an_iterator to be copied
+ */
+template <class ItemType, bool IsConst>
+ListIterator<ItemType, IsConst>::ListIterator(const ListIterator<ItemType, false> &an_iterator) : node_{an_iterator.node_}, list_{an_iterator.list_}
+{
+}
+
+/**
+ * @brief gets the item the iterator points to
+ *
+ * @return a reference to the item
+ */
+template <class ItemType, bool IsConst>
+typename ListIterator<ItemType, IsConst>::reference ListIterator<ItemType, IsConst>::operator*() const
+{
+    return node_->getItemReference();
+}
+
+/**
+ * @brief accesses a member of the item the iterator points to
+ *
+ * @return a pointer to the item
+ */
+template <class ItemType, bool IsConst>
+typename ListIterator<ItemType, IsConst>::pointer ListIterator<ItemType, IsConst>::operator->() const
+{
+    return &node_->getItemReference();
+}
+
+/**
+ * @brief moves to the next node
+ *
+ * @return a reference to this iterator
+ */
+template <class ItemType, bool IsConst>
+ListIterator<ItemType, IsConst> &ListIterator<ItemType, IsConst>::operator++()
+{
+    node_ = node_->peekNext();
+    return *this;
+}
+
+/**
+ * @brief moves to the next node
+ *
+ * @return a copy of this iterator from before the move
+ */
+template <class ItemType, bool IsConst>
+ListIterator<ItemType, IsConst> ListIterator<ItemType, IsConst>::operator++(int)
+{
+    ListIterator<ItemType, IsConst> previous = *this;
+    ++(*this);
+    return previous;
+}
+
+/**
+ * @brief moves to the previous node - from the end of the list, that is the last node
+ *
+ * @pre if the iterator is at the end, it was taken from the list it walks - an end() reached by walking off a node
+ * spliced in from another list would step back into that other list
+ * @return a reference to this iterator
+ */
+template <class ItemType, bool IsConst>
+ListIterator<ItemType, IsConst> &ListIterator<ItemType, IsConst>::operator--()
+{
+    node_ = node_ == nullptr ? list_->last_.get() : node_->peekPrevious();
+    return *this;
+}
+
+/**
+ * @brief moves to the previous node - from the end of the list, that is the last node
+ *
+ * @pre if the iterator is at the end, it was taken from the list it walks - an end() reached by walking off a node
+ * spliced in from another list would step back into that other list
+ * @return a copy of this iterator from before the move
+ */
+template <class ItemType, bool IsConst>
+ListIterator<ItemType, IsConst> ListIterator<ItemType, IsConst>::operator--(int)
+{
+    ListIterator<ItemType, IsConst> following = *this;
+    --(*this);
+    return following;
+}
+
+/**
+ * @brief checks if two iterators point to the same node
+ *
+ * @param rhs the other iterator
+ * @return true if both point to the same node, or both to the end of a list,
+ * @return false otherwise
+ * @note only the nodes are compared, so an iterator that followed its node into another list by splice still
+ * reaches that list's end()
+ */
+template <class ItemType, bool IsConst>
+bool ListIterator<ItemType, IsConst>::operator==(const ListIterator<ItemType, true> &rhs) const
+{
+    return node_ == rhs.node_;
+}
+
+/**
+ * @brief checks if two iterators point to different nodes
+ *
+ * @param rhs the other iterator
+ * @return true if the iterators point to different nodes,
+ * @return false otherwise
+ */
+template <class ItemType, bool IsConst>
+bool ListIterator<ItemType, IsConst>::operator!=(const ListIterator<ItemType, true> &rhs) const
+{
+    return !(*this == rhs);
+}
@@ -0,0 +1,139 @@
+/**
+ * @file ListIterator.hpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Interface for ListIterator class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef LIST_ITERATOR_
+#define LIST_ITERATOR_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include "../Node/Node.hpp"
+
+template <class ItemType>
+class DoublyLinkedList;
+
+/**
+ * @brief A bidirectional iterator over a DoublyLinkedList
+ *
+ * @tparam ItemType of the items in the list
+ * @tparam IsConst true for an iterator that only reads the items
+ * @note Steps through the raw links, so walking the list touches no reference count
+ * @note Stays valid until the node it points to is erased - inserting elsewhere does not invalidate it, and splicing
+ * its node into another list makes it an iterator into that list
+ * @note Stepping back from end() reads the list the iterator was made from - an end() reached by walking from a node
+ * that was spliced in from another list steps back into that other list, so take a fresh end() to walk backwards
+ */
+template <class ItemType, bool IsConst>
+class ListIterator
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = ItemType;
+    using difference_type = std::ptrdiff_t;
+    using reference = typename std::conditional<IsConst, const ItemType &, ItemType &>::type;
+    using pointer = typename std::conditional<IsConst, const ItemType *, ItemType *>::type;
+
+    /**
+     * @brief default constructor - the iterator points nowhere until assigned
+     */
+    ListIterator();
+
+    /**
+     * @brief parameterized constructor
+     *
+     * @param node to point to, or nullptr for the end of the list
+     * @param list the node belongs to
+     */
+    ListIterator(Node<ItemType> *node, const DoublyLinkedList<ItemType> *list);
+
+    /**
+     * @brief copy constructor - also turns an iterator into a read-only one
+     *
+     * @param an_iterator to be copied
+     */
+    ListIterator(const ListIterator<ItemType, false> &an_iterator);
+
+    /**
+     * @brief gets the item the iterator points to
+     *
+     * @return a reference to the item
+     */
+    reference operator*() const;
+
+    /**
+     * @brief accesses a member of the item the iterator points to
+     *
+     * @return a pointer to the item
+     */
+    pointer operator->() const;
+
+    /**
+     * @brief moves to the next node
+     *
+     * @return a reference to this iterator
+     */
+    ListIterator<ItemType, IsConst> &operator++();
+
+    /**
+     * @brief moves to the next node
+     *
+     * @return a copy of this iterator from before the move
+     */
+    ListIterator<ItemType, IsConst> operator++(int);
+
+    /**
+     * @brief moves to the previous node - from the end of the list, that is the last node
+     *
+     * @pre if the iterator is at the end, it was taken from the list it walks - an end() reached by walking off a node
+     * spliced in from another list would step back into that other list
+     * @return a reference to this iterator
+     */
+    ListIterator<ItemType, IsConst> &operator--();
+
+    /**
+     * @brief moves to the previous node - from the end of the list, that is the last node
+     *
+     * @pre if the iterator is at the end, it was taken from the list it walks - an end() reached by walking off a node
+     * spliced in from another list would step back into that other list
+     * @return a copy of this iterator from before the move
+     */
+    ListIterator<ItemType, IsConst> operator--(int);
+
+    /**
+     * @brief checks if two iterators point to the same node
+     *
+     * @param rhs the other iterator
+     * @return true if both point to the same node, or both to the end of a list,
+     * @return false otherwise
+     * @note only the nodes are compared, so an iterator that followed its node into another list by splice still
+     * reaches that list's end()
+     */
+    bool operator==(const ListIterator<ItemType, true> &rhs) const;
+
+    /**
+     * @brief checks if two iterators point to different nodes
+     *
+     * @param rhs the other iterator
+     * @return true if the iterators point to different nodes,
+     * @return false otherwise
+     */
+    bool operator!=(const ListIterator<ItemType, true> &rhs) const;
+
+private:
+    Node<ItemType> *node_;
+    const DoublyLinkedList<ItemType> *list_;
+
+    friend class DoublyLinkedList<ItemType>;
+    friend class ListIterator<ItemType, !IsConst>;
+};
+
+#include "ListIterator.cpp"
+#endif
@@ -0,0 +1,580 @@
+/**
+ * @file UnrolledLinkedList.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Implementation for UnrolledLinkedList class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "UnrolledLinkedList.hpp"
+
+/**
+ * @brief default constructor
+ */
+template <class ItemType, int ChunkCapacity>
+UnrolledLinkedList<ItemType, ChunkCapacity>::UnrolledLinkedList() : first_{nullptr},
+                                                                    last_{nullptr},
+                                                                    item_count_{0},
+                                                                    chunk_count_{0},
+                                                                    memory_resource_{std::pmr::get_default_resource()}
+{
+}
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param memory_resource to allocate every node from
+ */
+template <class ItemType, int ChunkCapacity>
+UnrolledLinkedList<ItemType, ChunkCapacity>::UnrolledLinkedList(std::pmr::memory_resource *memory_resource) : first_{nullptr},
+                                                                                                              last_{nullptr},
+                                                                                                              item_count_{0},
+                                                                                                              chunk_count_{0},
+                                                                                                              memory_resource_{memory_resource}
+{
+}
+
+/**
+ * @brief copy constructor
+ *
+ * @param a_list to be copied
+ * @note the copy allocates its nodes from the same memory resource as a_list, and packs them full
+ */
+template <class ItemType, int ChunkCapacity>
+UnrolledLinkedList<ItemType, ChunkCapacity>::UnrolledLinkedList(const UnrolledLinkedList<ItemType, ChunkCapacity> &a_list) : UnrolledLinkedList(a_list.memory_resource_)
+{
+    copyFrom(a_list);
+}
+
+/**
+ * @brief destructor - destroys every item and frees every node
+ */
+template <class ItemType, int ChunkCapacity>
+UnrolledLinkedList<ItemType, ChunkCapacity>::~UnrolledLinkedList()
+{
+    clear();
+}
+
+/**
+ * @brief copy assignment operator
+ *
+ * @param a_list to be copied
+ * @return a reference to this list
+ */
+template <class ItemType, int ChunkCapacity>
+UnrolledLinkedList<ItemType, ChunkCapacity> &UnrolledLinkedList<ItemType, ChunkCapacity>::operator=(const UnrolledLinkedList<ItemType, ChunkCapacity> &a_list)
+{
+    if (this != &a_list)
+    {
+        // Copy first so that this list is left untouched if copying throws, then take over the copied nodes
+        UnrolledLinkedList<ItemType, ChunkCapacity> copy(memory_resource_);
+        copy.copyFrom(a_list);
+        clear();
+        std::swap(first_, copy.first_);
+        std::swap(last_, copy.last_);
+        std::swap(item_count_, copy.item_count_);
+        std::swap(chunk_count_, copy.chunk_count_);
+    }
+    return *this;
+}
+
+/**
+ * @brief checks if the list is empty
+ *
+ * @return true if the list is empty,
+ * @return false otherwise
+ */
+template <class ItemType, int ChunkCapacity>
+bool UnrolledLinkedList<ItemType, ChunkCapacity>::isEmpty() const
+{
+    return item_count_ == 0;
+}
+
+/**
+ * @brief gets the length of the list
+ *
+ * @return the number of items in the list
+ */
+template <class ItemType, int ChunkCapacity>
+size_t UnrolledLinkedList<ItemType, ChunkCapacity>::getLength() const
+{
+    return item_count_;
+}
+
+/**
+ * @brief gets the item at a position
+ *
+ * @pre 0 <= position < item_count_
+ * @param position of the item to be retrieved
+ * @return the item at position in list if there is one, otherwise it throws exception: PrecondViolatedExcep
+ */
+template <class ItemType, int ChunkCapacity>
+ItemType UnrolledLinkedList<ItemType, ChunkCapacity>::getItem(const size_t &position) const
+{
+    if (position < item_count_)
+    {
+        int offset;
+        Chunk *chunk = locate(position, offset);
+        return chunk->items()[offset];
+    }
+    else
+    {
+        throw std::runtime_error("PrecondViolatedExcep");
+    }
+}
+
+/**
+ * @brief inserts an item at a position
+ *
+ * @param position indicating point of insertion
+ * @param new_element to be inserted in list
+ * @post new_element is added at position in list (the item previously at that position is now at position+1)
+ * @return true always - it always inserts, if position > item_count_, then it inserts at end of list
+ */
+template <class ItemType, int ChunkCapacity>
+bool UnrolledLinkedList<ItemType, ChunkCapacity>::insert(const size_t &position, const ItemType &new_element)
+{
+    // Copy first, so that a throwing copy leaves the list untouched and new_element may refer into the list
+    ItemType new_item(new_element);
+
+    if (first_ == nullptr)
+    {
+        addChunkAfter(nullptr);
+    }
+
+    int offset;
+    Chunk *chunk = locate(position < item_count_ ? position : item_count_, offset);
+
+    if (chunk->count == ChunkCapacity)
+    {
+        if (offset == ChunkCapacity)
+        {
+            // Appending to a full node - use the next node if it has room, so that push_back() fills nodes completely
+            chunk = (chunk->next != nullptr && chunk->next->count < ChunkCapacity) ? chunk->next : addChunkAfter(chunk);
+            offset = 0;
+        }
+        else if (offset == 0 && chunk->prev != nullptr && chunk->prev->count < ChunkCapacity)
+        {
+            chunk = chunk->prev;
+            offset = chunk->count;
+        }
+        else if (offset == 0)
+        {
+            // Prepending to a full node - likewise keeps push_front() filling nodes completely
+            chunk = addChunkAfter(chunk->prev);
+        }
+        else
+        {
+            Chunk *upper = split(chunk);
+            if (offset > chunk->count)
+            {
+                offset -= chunk->count;
+                chunk = upper;
+            }
+        }
+    }
+
+    // Shift the items after offset right by one
+    ItemType *items = chunk->items();
+    if (offset == chunk->count)
+    {
+        new (items + offset) ItemType(std::move(new_item));
+    }
+    else
+    {
+        new (items + chunk->count) ItemType(std::move(items[chunk->count - 1]));
+        std::move_backward(items + offset, items + chunk->count - 1, items + chunk->count);
+        items[offset] = std::move(new_item);
+    }
+
+    chunk->count++;
+    item_count_++;
+    return true;
+}
+
+/**
+ * @brief inserts an item at the end of the list
+ *
+ * @param new_element to be inserted in list
+ * @post new_element is added at the end of the list
+ * @return true always - it always inserts
+ */
+template <class ItemType, int ChunkCapacity>
+bool UnrolledLinkedList<ItemType, ChunkCapacity>::push_back(const ItemType &new_element)
+{
+    return insert(item_count_, new_element);
+}
+
+/**
+ * @brief inserts an item at the front of the list
+ *
+ * @param new_element to be inserted in list
+ * @post new_element is added at the front of the list
+ * @return true always - it always inserts
+ */
+template <class ItemType, int ChunkCapacity>
+bool UnrolledLinkedList<ItemType, ChunkCapacity>::push_front(const ItemType &new_element)
+{
+    return insert(0, new_element);
+}
+
+/**
+ * @brief deletes the item at a position
+ *
+ * @param position indicating point of deletion
+ * @post item at position is deleted, if any. List order is retained
+ * @return true if there is an item at position to be deleted,
+ * @return false otherwise
+ */
+template <class ItemType, int ChunkCapacity>
+bool UnrolledLinkedList<ItemType, ChunkCapacity>::remove(const size_t &position)
+{
+    if (position >= item_count_)
+    {
+        return false;
+    }
+
+    int offset;
+    Chunk *chunk = locate(position, offset);
+
+    // Shift the items after offset left by one
+    ItemType *items = chunk->items();
+    std::move(items + offset + 1, items + chunk->count, items + offset);
+    items[chunk->count - 1].~ItemType();
+    chunk->count--;
+    item_count_--;
+
+    // Keep the nodes at least half full, merging with a neighbour once both fit in one
+    if (chunk->count == 0)
+    {
+        freeChunk(chunk);
+    }
+    else if (chunk->count < ChunkCapacity / 2)
+    {
+        if (chunk->next != nullptr && chunk->count + chunk->next->count <= ChunkCapacity)
+        {
+            mergeWithNext(chunk);
+        }
+        else if (chunk->prev != nullptr && chunk->prev->count + chunk->count <= ChunkCapacity)
+        {
+            mergeWithNext(chunk->prev);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief deletes the last item
+ *
+ * @post the last item is deleted, if any. List order is retained
+ * @return true if there is an item to be deleted,
+ * @return false otherwise
+ */
+template <class ItemType, int ChunkCapacity>
+bool UnrolledLinkedList<ItemType, ChunkCapacity>::pop_back()
+{
+    return remove(item_count_ - 1);
+}
+
+/**
+ * @brief deletes the first item
+ *
+ * @post the first item is deleted, if any. List order is retained
+ * @return true if there is an item to be deleted,
+ * @return false otherwise
+ */
+template <class ItemType, int ChunkCapacity>
+bool UnrolledLinkedList<ItemType, ChunkCapacity>::pop_front()
+{
+    return remove(0);
+}
+
+/**
+ * @brief deletes all items in the list and item_count_ is set to 0
+ */
+template <class ItemType, int ChunkCapacity>
+void UnrolledLinkedList<ItemType, ChunkCapacity>::clear()
+{
+    while (first_ != nullptr)
+    {
+        Chunk *chunk = first_;
+        ItemType *items = chunk->items();
+        for (int i = 0; i < chunk->count; i++)
+        {
+            items[i].~ItemType();
+        }
+        chunk->count = 0;
+        freeChunk(chunk);
+    }
+    item_count_ = 0;
+}
+
+/**
+ * @brief prints the contents of the list
+ *
+ * @note the items are written in large blocks, and std::cout is flushed once at the end
+ */
+template <class ItemType, int ChunkCapacity>
+void UnrolledLinkedList<ItemType, ChunkCapacity>::display()
+{
+    display(std::cout);
+    std::cout.flush();
+}
+
+/**
+ * @brief writes the contents of the list to a stream, separated by spaces and ending in a newline
+ *
+ * @param out the stream to write to - it is written in large blocks and never flushed
+ */
+template <class ItemType, int ChunkCapacity>
+void UnrolledLinkedList<ItemType, ChunkCapacity>::display(std::ostream &out) const
+{
+    BufferedWriter writer(out);
+    display(writer);
+    writer.flush();
+}
+
+/**
+ * @brief writes the contents of the list into a writer, separated by spaces and ending in a newline
+ *
+ * @param writer to write to - nothing reaches its sink until it fills up or is flushed
+ */
+template <class ItemType, int ChunkCapacity>
+void UnrolledLinkedList<ItemType, ChunkCapacity>::display(BufferedWriter &writer) const
+{
+    for (Chunk *chunk = first_; chunk != nullptr; chunk = chunk->next)
+    {
+        ItemType *items = chunk->items();
+        for (int i = 0; i < chunk->count; i++)
+        {
+            writer.write(items[i]);
+            writer.put(chunk->next == nullptr && i == chunk->count - 1 ? '\n' : ' ');
+        }
+    }
+}
+
+/**
+ * @brief swaps the items at positions i and j (i must be less than j)
+ *
+ * @pre i < j
+ * @param i is the index (integer) of the first item we are swapping in the list
+ * @param j is the index (integer) of the second item we are swapping in the list
+ * @post swaps the element at position i with the element at position j
+ */
+template <class ItemType, int ChunkCapacity>
+void UnrolledLinkedList<ItemType, ChunkCapacity>::swap(const int &i, const int &j)
+{
+    if (0 <= i && i < j && static_cast<size_t>(j) < item_count_)
+    {
+        int first_offset;
+        int second_offset;
+        Chunk *first = locate(i, first_offset);
+        Chunk *second = locate(j, second_offset);
+
+        std::swap(first->items()[first_offset], second->items()[second_offset]);
+    }
+}
+
+/**
+ * @brief gets the number of nodes in the list
+ *
+ * @return the number of nodes
+ */
+template <class ItemType, int ChunkCapacity>
+size_t UnrolledLinkedList<ItemType, ChunkCapacity>::getNodeCount() const
+{
+    return chunk_count_;
+}
+
+/**
+ * @brief gets the memory resource the list allocates its nodes from
+ *
+ * @return a pointer to the memory resource
+ */
+template <class ItemType, int ChunkCapacity>
+std::pmr::memory_resource *UnrolledLinkedList<ItemType, ChunkCapacity>::getMemoryResource() const
+{
+    return memory_resource_;
+}
+
+//********* PRIVATE METHODS **************//
+
+/**
+ * @brief gets the node's array of items
+ *
+ * @return a pointer to the first item
+ */
+template <class ItemType, int ChunkCapacity>
+ItemType *UnrolledLinkedList<ItemType, ChunkCapacity>::Chunk::items()
+{
+    return std::launder(reinterpret_cast<ItemType *>(storage));
+}
+
+/**
+ * @brief finds the node holding the item at a position, walking from whichever end of the list is nearer
+ *
+ * @param position of the item, at most item_count_
+ * @param offset set to the index of the item within the node
+ * @return the node - for position == item_count_, the last node with offset equal to its count
+ */
+template <class ItemType, int ChunkCapacity>
+typename UnrolledLinkedList<ItemType, ChunkCapacity>::Chunk *UnrolledLinkedList<ItemType, ChunkCapacity>::locate(const size_t &position, int &offset) const
+{
+    if (position < item_count_ / 2)
+    {
+        Chunk *chunk = first_;
+        size_t remaining = position;
+        while (remaining >= static_cast<size_t>(chunk->count))
+        {
+            remaining -= chunk->count;
+            chunk = chunk->next;
+        }
+        offset = static_cast<int>(remaining);
+        return chunk;
+    }
+    else
+    {
+        // Count the items from position to the end instead
+        Chunk *chunk = last_;
+        size_t remaining = item_count_ - position;
+        while (remaining > static_cast<size_t>(chunk->count))
+        {
+            remaining -= chunk->count;
+            chunk = chunk->prev;
+        }
+        offset = chunk->count - static_cast<int>(remaining);
+        return chunk;
+    }
+}
+
+/**
+ * @brief allocates an empty node and links it in after previous
+ *
+ * @param previous the node to link the new one after, or nullptr to make it the first node
+ * @return the new node
+ */
+template <class ItemType, int ChunkCapacity>
+typename UnrolledLinkedList<ItemType, ChunkCapacity>::Chunk *UnrolledLinkedList<ItemType, ChunkCapacity>::addChunkAfter(Chunk *previous)
+{
+    Chunk *chunk = new (memory_resource_->allocate(sizeof(Chunk), alignof(Chunk))) Chunk;
+    chunk->count = 0;
+    chunk->prev = previous;
+    chunk->next = previous == nullptr ? first_ : previous->next;
+
+    if (chunk->next == nullptr)
+    {
+        last_ = chunk;
+    }
+    else
+    {
+        chunk->next->prev = chunk;
+    }
+
+    if (previous == nullptr)
+    {
+        first_ = chunk;
+    }
+    else
+    {
+        previous->next = chunk;
+    }
+
+    chunk_count_++;
+    return chunk;
+}
+
+/**
+ * @brief unlinks an empty node and frees it
+ *
+ * @param chunk to be freed
+ */
+template <class ItemType, int ChunkCapacity>
+void UnrolledLinkedList<ItemType, ChunkCapacity>::freeChunk(Chunk *chunk)
+{
+    if (chunk->prev == nullptr)
+    {
+        first_ = chunk->next;
+    }
+    else
+    {
+        chunk->prev->next = chunk->next;
+    }
+
+    if (chunk->next == nullptr)
+    {
+        last_ = chunk->prev;
+    }
+    else
+    {
+        chunk->next->prev = chunk->prev;
+    }
+
+    memory_resource_->deallocate(chunk, sizeof(Chunk), alignof(Chunk));
+    chunk_count_--;
+}
+
+/**
+ * @brief moves the upper half of a full node's items into a new node linked in after it
+ *
+ * @param chunk to be split
+ * @return the new node
+ */
+template <class ItemType, int ChunkCapacity>
+typename UnrolledLinkedList<ItemType, ChunkCapacity>::Chunk *UnrolledLinkedList<ItemType, ChunkCapacity>::split(Chunk *chunk)
+{
+    Chunk *upper = addChunkAfter(chunk);
+    int half = chunk->count / 2;
+    ItemType *items = chunk->items();
+    ItemType *upper_items = upper->items();
+    for (int i = half; i < chunk->count; i++)
+    {
+        new (upper_items + (i - half)) ItemType(std::move(items[i]));
+        items[i].~ItemType();
+    }
+    upper->count = chunk->count - half;
+    chunk->count = half;
+    return upper;
+}
+
+/**
+ * @brief moves every item of chunk's successor into chunk and frees the successor
+ *
+ * @pre chunk->count + chunk->next->count <= ChunkCapacity
+ * @param chunk to be merged with its successor
+ */
+template <class ItemType, int ChunkCapacity>
+void UnrolledLinkedList<ItemType, ChunkCapacity>::mergeWithNext(Chunk *chunk)
+{
+    Chunk *next = chunk->next;
+    ItemType *items = chunk->items();
+    ItemType *next_items = next->items();
+    for (int i = 0; i < next->count; i++)
+    {
+        new (items + chunk->count + i) ItemType(std::move(next_items[i]));
+        next_items[i].~ItemType();
+    }
+    chunk->count += next->count;
+    next->count = 0;
+    freeChunk(next);
+}
+
+/**
+ * @brief appends copies of every item of a_list
+ *
+ * @param a_list to be copied
+ */
+template <class ItemType, int ChunkCapacity>
+void UnrolledLinkedList<ItemType, ChunkCapacity>::copyFrom(const UnrolledLinkedList<ItemType, ChunkCapacity> &a_list)
+{
+    for (Chunk *chunk = a_list.first_; chunk != nullptr; chunk = chunk->next)
+    {
+        ItemType *items = chunk->items();
+        for (int i = 0; i < chunk->count; i++)
+        {
+            push_back(items[i]);
+        }
+    }
+}
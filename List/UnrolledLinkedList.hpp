@@ -0,0 +1,276 @@
+/**
+ * @file UnrolledLinkedList.hpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Interface for UnrolledLinkedList class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef UNROLLED_LINKED_LIST_
+#define UNROLLED_LINKED_LIST_
+
+#include <algorithm>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "../Output/BufferedWriter.hpp"
+
+/**
+ * @brief A doubly linked list whose nodes each hold a small array of items, with the same interface as DoublyLinkedList
+ *
+ * @tparam ItemType of the items in the list
+ * @tparam ChunkCapacity the number of items a node can hold - by default as many as fit in about 512 bytes
+ * @note A full node is split in half to make room in its middle, appending or prepending to a full node starts a new
+ * one, and a node that drops below half full is merged with a neighbour when both fit in one
+ * @note Storing many items per node cuts the per-item overhead to a fraction of a pointer, and scans read items that
+ * sit next to each other in memory
+ */
+template <class ItemType, int ChunkCapacity = (512 / sizeof(ItemType) > 4 ? static_cast<int>(512 / sizeof(ItemType)) : 4)>
+class UnrolledLinkedList
+{
+    static_assert(ChunkCapacity >= 2, "UnrolledLinkedList needs at least two items per node");
+
+public:
+    /**
+     * @brief default constructor
+     */
+    UnrolledLinkedList();
+
+    /**
+     * @brief parameterized constructor
+     *
+     * @param memory_resource to allocate every node from
+     */
+    explicit UnrolledLinkedList(std::pmr::memory_resource *memory_resource);
+
+    /**
+     * @brief copy constructor
+     *
+     * @param a_list to be copied
+     * @note the copy allocates its nodes from the same memory resource as a_list, and packs them full
+     */
+    UnrolledLinkedList(const UnrolledLinkedList<ItemType, ChunkCapacity> &a_list);
+
+    /**
+     * @brief destructor - destroys every item and frees every node
+     */
+    ~UnrolledLinkedList();
+
+    /**
+     * @brief copy assignment operator
+     *
+     * @param a_list to be copied
+     * @return a reference to this list
+     */
+    UnrolledLinkedList<ItemType, ChunkCapacity> &operator=(const UnrolledLinkedList<ItemType, ChunkCapacity> &a_list);
+
+    /**
+     * @brief checks if the list is empty
+     *
+     * @return true if the list is empty,
+     * @return false otherwise
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief gets the length of the list
+     *
+     * @return the number of items in the list
+     */
+    size_t getLength() const;
+
+    /**
+     * @brief gets the item at a position
+     *
+     * @pre 0 <= position < item_count_
+     * @param position of the item to be retrieved
+     * @return the item at position in list if there is one, otherwise it throws exception: PrecondViolatedExcep
+     */
+    ItemType getItem(const size_t &position) const;
+
+    /**
+     * @brief inserts an item at a position
+     *
+     * @param position indicating point of insertion
+     * @param new_element to be inserted in list
+     * @post new_element is added at position in list (the item previously at that position is now at position+1)
+     * @return true always - it always inserts, if position > item_count_, then it inserts at end of list
+     */
+    bool insert(const size_t &position, const ItemType &new_element);
+
+    /**
+     * @brief inserts an item at the end of the list
+     *
+     * @param new_element to be inserted in list
+     * @post new_element is added at the end of the list
+     * @return true always - it always inserts
+     */
+    bool push_back(const ItemType &new_element);
+
+    /**
+     * @brief inserts an item at the front of the list
+     *
+     * @param new_element to be inserted in list
+     * @post new_element is added at the front of the list
+     * @return true always - it always inserts
+     */
+    bool push_front(const ItemType &new_element);
+
+    /**
+     * @brief deletes the item at a position
+     *
+     * @param position indicating point of deletion
+     * @post item at position is deleted, if any. List order is retained
+     * @return true if there is an item at position to be deleted,
+     * @return false otherwise
+     */
+    bool remove(const size_t &position);
+
+    /**
+     * @brief deletes the last item
+     *
+     * @post the last item is deleted, if any. List order is retained
+     * @return true if there is an item to be deleted,
+     * @return false otherwise
+     */
+    bool pop_back();
+
+    /**
+     * @brief deletes the first item
+     *
+     * @post the first item is deleted, if any. List order is retained
+     * @return true if there is an item to be deleted,
+     * @return false otherwise
+     */
+    bool pop_front();
+
+    /**
+     * @brief deletes all items in the list and item_count_ is set to 0
+     */
+    void clear();
+
+    /**
+     * @brief prints the contents of the list
+     *
+     * @note the items are written in large blocks, and std::cout is flushed once at the end
+     */
+    void display();
+
+    /**
+     * @brief writes the contents of the list to a stream, separated by spaces and ending in a newline
+     *
+     * @param out the stream to write to - it is written in large blocks and never flushed
+     */
+    void display(std::ostream &out) const;
+
+    /**
+     * @brief writes the contents of the list into a writer, separated by spaces and ending in a newline
+     *
+     * @param writer to write to - nothing reaches its sink until it fills up or is flushed
+     */
+    void display(BufferedWriter &writer) const;
+
+    /**
+     * @brief swaps the items at positions i and j (i must be less than j)
+     *
+     * @pre i < j
+     * @param i is the index (integer) of the first item we are swapping in the list
+     * @param j is the index (integer) of the second item we are swapping in the list
+     * @post swaps the element at position i with the element at position j
+     */
+    void swap(const int &i, const int &j);
+
+    /**
+     * @brief gets the number of nodes in the list
+     *
+     * @return the number of nodes
+     */
+    size_t getNodeCount() const;
+
+    /**
+     * @brief gets the memory resource the list allocates its nodes from
+     *
+     * @return a pointer to the memory resource
+     */
+    std::pmr::memory_resource *getMemoryResource() const;
+
+private:
+    /**
+     * @brief a node holding up to ChunkCapacity items, packed at the front of its array
+     */
+    struct Chunk
+    {
+        Chunk *next;
+        Chunk *prev;
+        int count;
+        alignas(ItemType) unsigned char storage[sizeof(ItemType) * ChunkCapacity];
+
+        /**
+         * @brief gets the node's array of items
+         *
+         * @return a pointer to the first item
+         */
+        ItemType *items();
+    };
+
+    Chunk *first_;
+    Chunk *last_;
+    size_t item_count_;
+    size_t chunk_count_;
+    std::pmr::memory_resource *memory_resource_;
+
+    /**
+     * @brief finds the node holding the item at a position, walking from whichever end of the list is nearer
+     *
+     * @param position of the item, at most item_count_
+     * @param offset set to the index of the item within the node
+     * @return the node - for position == item_count_, the last node with offset equal to its count
+     */
+    Chunk *locate(const size_t &position, int &offset) const;
+
+    /**
+     * @brief allocates an empty node and links it in after previous
+     *
+     * @param previous the node to link the new one after, or nullptr to make it the first node
+     * @return the new node
+     */
+    Chunk *addChunkAfter(Chunk *previous);
+
+    /**
+     * @brief unlinks an empty node and frees it
+     *
+     * @param chunk to be freed
+     */
+    void freeChunk(Chunk *chunk);
+
+    /**
+     * @brief moves the upper half of a full node's items into a new node linked in after it
+     *
+     * @param chunk to be split
+     * @return the new node
+     */
+    Chunk *split(Chunk *chunk);
+
+    /**
+     * @brief moves every item of chunk's successor into chunk and frees the successor
+     *
+     * @pre chunk->count + chunk->next->count <= ChunkCapacity
+     * @param chunk to be merged with its successor
+     */
+    void mergeWithNext(Chunk *chunk);
+
+    /**
+     * @brief appends copies of every item of a_list
+     *
+     * @param a_list to be copied
+     */
+    void copyFrom(const UnrolledLinkedList<ItemType, ChunkCapacity> &a_list);
+};
+
+#include "UnrolledLinkedList.cpp"
+#endif
@@ -17,7 +17,7 @@
 template <class ItemType>
 Node<ItemType>::Node() : item_{},
                          next_{std::shared_ptr<Node<ItemType>>(nullptr)},
-                         prev_{std::shared_ptr<Node<ItemType>>(nullptr)}
+                         prev_{nullptr}
 {
 }
 
@@ -29,7 +29,32 @@ Node<ItemType>::Node() : item_{},
 template <class ItemType>
 Node<ItemType>::Node(const ItemType &an_item) : item_{an_item},
                                                 next_{std::shared_ptr<Node<ItemType>>(nullptr)},
-                                                prev_{std::shared_ptr<Node<ItemType>>(nullptr)}
+                                                prev_{nullptr}
+{
+}
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param an_item to be moved into the node
+ */
+template <class ItemType>
+Node<ItemType>::Node(ItemType &&an_item) : item_{std::move(an_item)},
+                                           next_{std::shared_ptr<Node<ItemType>>(nullptr)},
+                                           prev_{nullptr}
+{
+}
+
+/**
+ * @brief constructs the item in place
+ *
+ * @param args to be forwarded to the constructor of ItemType
+ */
+template <class ItemType>
+template <class... Args>
+Node<ItemType>::Node(std::in_place_t, Args &&...args) : item_(std::forward<Args>(args)...),
+                                                        next_{std::shared_ptr<Node<ItemType>>(nullptr)},
+                                                        prev_{nullptr}
 {
 }
 
@@ -42,7 +67,7 @@ Node<ItemType>::Node(const ItemType &an_item) : item_{an_item},
 template <class ItemType>
 Node<ItemType>::Node(const ItemType &an_item, const std::shared_ptr<Node<ItemType>> &next_node_ptr) : item_{an_item},
                                                                                                       next_{next_node_ptr},
-                                                                                                      prev_{std::shared_ptr<Node<ItemType>>(nullptr)}
+                                                                                                      prev_{nullptr}
 {
 }
 
@@ -55,10 +80,31 @@ Node<ItemType>::Node(const ItemType &an_item, const std::shared_ptr<Node<ItemTyp
 template <class ItemType>
 Node<ItemType>::Node(const ItemType &an_item, const std::shared_ptr<Node<ItemType>> &next_node_ptr, const std::shared_ptr<Node<ItemType>> &prev_node_ptr) : item_{an_item},
                                                                                                                                                             next_{next_node_ptr},
-                                                                                                                                                            prev_{prev_node_ptr}
+                                                                                                                                                            prev_{prev_node_ptr.get()}
 {
 }
 
+/**
+ * @brief destructor - frees the rest of the chain that only this node owns one node at a time, rather than through
+ * nested shared_ptr destructors that could overflow the stack on a long chain
+ */
+template <class ItemType>
+Node<ItemType>::~Node()
+{
+    std::shared_ptr<Node<ItemType>> next_node_ptr = std::move(next_);
+    while (next_node_ptr != nullptr && next_node_ptr.use_count() == 1)
+    {
+        // Detach the following node before the current one is released, so that its destructor has nothing to follow
+        next_node_ptr = std::move(next_node_ptr->next_);
+    }
+
+    // The first node that outlives the chain must not point back into it
+    if (next_node_ptr != nullptr)
+    {
+        next_node_ptr->prev_ = nullptr;
+    }
+}
+
 /**
  * @brief sets the item to be held by the node
  *
@@ -70,6 +116,17 @@ void Node<ItemType>::setItem(const ItemType &an_item)
     item_ = an_item;
 }
 
+/**
+ * @brief moves an item into the node
+ *
+ * @param an_item to be moved into the node
+ */
+template <class ItemType>
+void Node<ItemType>::setItem(ItemType &&an_item)
+{
+    item_ = std::move(an_item);
+}
+
 /**
  * @brief sets the pointer to the next node in the chain
  *
@@ -84,21 +141,43 @@ void Node<ItemType>::setNext(const std::shared_ptr<Node<ItemType>> next_node_ptr
 /**
  * @brief sets the pointer to the previous node in the chain
  *
- * @param prev_node_ptr to point to the previous node in the chain
+ * @param prev_node_ptr to point to the previous node in the chain - it is not kept alive by this node
  */
 template <class ItemType>
 void Node<ItemType>::setPrevious(const std::shared_ptr<Node<ItemType>> prev_node_ptr)
 {
-    prev_ = prev_node_ptr;
+    prev_ = prev_node_ptr.get();
 }
 
 /**
  * @brief gets the item held by the node
  *
- * @return the object held by the node
+ * @return a read-only reference to the object held by the node
+ */
+template <class ItemType>
+const ItemType &Node<ItemType>::getItem() const
+{
+    return item_;
+}
+
+/**
+ * @brief gets a reference to the item held by the node
+ *
+ * @return a reference to the object held by the node
+ */
+template <class ItemType>
+ItemType &Node<ItemType>::getItemReference()
+{
+    return item_;
+}
+
+/**
+ * @brief gets a read-only reference to the item held by the node
+ *
+ * @return a read-only reference to the object held by the node
  */
 template <class ItemType>
-ItemType Node<ItemType>::getItem() const
+const ItemType &Node<ItemType>::getItemReference() const
 {
     return item_;
 }
@@ -117,10 +196,32 @@ std::shared_ptr<Node<ItemType>> Node<ItemType>::getNext() const
 /**
  * @brief gets the pointer to the previous node in the chain
  *
- * @return the pointer to the next node in the chain
+ * @return the pointer to the previous node in the chain, or nullptr if there is none
  */
 template <class ItemType>
 std::shared_ptr<Node<ItemType>> Node<ItemType>::getPrevious() const
+{
+    return prev_ == nullptr ? std::shared_ptr<Node<ItemType>>(nullptr) : prev_->shared_from_this();
+}
+
+/**
+ * @brief gets the next node in the chain without touching any reference count
+ *
+ * @return a non-owning pointer to the next node in the chain, or nullptr if there is none
+ */
+template <class ItemType>
+Node<ItemType> *Node<ItemType>::peekNext() const
+{
+    return next_.get();
+}
+
+/**
+ * @brief gets the previous node in the chain without touching any reference count
+ *
+ * @return a non-owning pointer to the previous node in the chain, or nullptr if there is none
+ */
+template <class ItemType>
+Node<ItemType> *Node<ItemType>::peekPrevious() const
 {
     return prev_;
 }
\ No newline at end of file
@@ -14,9 +14,18 @@
 
 #include <iostream>
 #include <memory>
+#include <utility>
 
+/**
+ * @brief A node of a doubly linked chain
+ *
+ * @note Only the next link owns its node - the previous link is a plain pointer, so adjacent nodes never keep each
+ * other alive and an unlinked node is freed as soon as the last owner lets go of it. A node that is freed clears the
+ * previous link of a successor that outlives it
+ * @note Nodes must be owned by a std::shared_ptr, which getPrevious() recovers through shared_from_this()
+ */
 template <class ItemType>
-class Node
+class Node : public std::enable_shared_from_this<Node<ItemType>>
 {
 public:
     /**
@@ -31,6 +40,21 @@ public:
      */
     Node(const ItemType &an_item);
 
+    /**
+     * @brief parameterized constructor
+     *
+     * @param an_item to be moved into the node
+     */
+    Node(ItemType &&an_item);
+
+    /**
+     * @brief constructs the item in place
+     *
+     * @param args to be forwarded to the constructor of ItemType
+     */
+    template <class... Args>
+    explicit Node(std::in_place_t, Args &&...args);
+
     /**
      * @brief parameterized constructor
      *
@@ -48,6 +72,15 @@ public:
      */
     Node(const ItemType &an_item, const std::shared_ptr<Node<ItemType>> &next_node_ptr, const std::shared_ptr<Node<ItemType>> &prev_node_ptr);
 
+    /**
+     * @brief destructor - frees the rest of the chain that only this node owns one node at a time, rather than through
+     * nested shared_ptr destructors that could overflow the stack on a long chain
+     */
+    ~Node();
+
+    Node(const Node<ItemType> &a_node) = delete;
+    Node<ItemType> &operator=(const Node<ItemType> &a_node) = delete;
+
     /**
      * @brief sets the item to be held by the node
      *
@@ -55,6 +88,13 @@ public:
      */
     void setItem(const ItemType &an_item);
 
+    /**
+     * @brief moves an item into the node
+     *
+     * @param an_item to be moved into the node
+     */
+    void setItem(ItemType &&an_item);
+
     /**
      * @brief sets the pointer to the next node in the chain
      *
@@ -65,16 +105,30 @@ public:
     /**
      * @brief sets the pointer to the previous node in the chain
      *
-     * @param prev_node_ptr to point to the previous node in the chain
+     * @param prev_node_ptr to point to the previous node in the chain - it is not kept alive by this node
      */
     void setPrevious(const std::shared_ptr<Node<ItemType>> prev_node_ptr);
 
     /**
      * @brief gets the item held by the node
      *
-     * @return the object held by the node
+     * @return a read-only reference to the object held by the node
+     */
+    const ItemType &getItem() const;
+
+    /**
+     * @brief gets a reference to the item held by the node
+     *
+     * @return a reference to the object held by the node
+     */
+    ItemType &getItemReference();
+
+    /**
+     * @brief gets a read-only reference to the item held by the node
+     *
+     * @return a read-only reference to the object held by the node
      */
-    ItemType getItem() const;
+    const ItemType &getItemReference() const;
 
     /**
      * @brief gets the pointer to the next node in the chain
@@ -86,14 +140,28 @@ public:
     /**
      * @brief gets the pointer to the previous node in the chain
      *
-     * @return the pointer to the next node in the chain
+     * @return the pointer to the previous node in the chain, or nullptr if there is none
      */
     std::shared_ptr<Node<ItemType>> getPrevious() const;
 
+    /**
+     * @brief gets the next node in the chain without touching any reference count
+     *
+     * @return a non-owning pointer to the next node in the chain, or nullptr if there is none
+     */
+    Node<ItemType> *peekNext() const;
+
+    /**
+     * @brief gets the previous node in the chain without touching any reference count
+     *
+     * @return a non-owning pointer to the previous node in the chain, or nullptr if there is none
+     */
+    Node<ItemType> *peekPrevious() const;
+
 private:
     ItemType item_;
     std::shared_ptr<Node<ItemType>> next_;
-    std::shared_ptr<Node<ItemType>> prev_;
+    Node<ItemType> *prev_;
 };
 
 #include "Node.cpp"
@@ -0,0 +1,298 @@
+/**
+ * @file NodePool.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Implementation for NodePool and NodeAllocator classes
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "NodePool.hpp"
+
+/**
+ * @brief creates a pool
+ *
+ * @param upstream to allocate the pool and its chunks from
+ * @return a pointer to the new pool, owned by the caller until it calls abandon()
+ */
+inline NodePool *NodePool::create(std::pmr::memory_resource *upstream)
+{
+    void *storage = upstream->allocate(sizeof(NodePool), alignof(NodePool));
+    return ::new (storage) NodePool(upstream);
+}
+
+/**
+ * @brief hands out a block - from the free list, from the blocks freed by other threads, or carved from a chunk
+ *
+ * @pre only called by the owner
+ * @param bytes the size of the block - every call must ask for the same size and alignment as the first one
+ * @param alignment of the block
+ * @throw std::bad_alloc if the chunk cannot be allocated, or bytes or alignment differ from the first call
+ * @return a pointer to the block
+ */
+inline void *NodePool::allocate(const std::size_t &bytes, const std::size_t &alignment)
+{
+    if (bytes != block_size_ || alignment != block_alignment_)
+    {
+        if (block_size_ != 0)
+        {
+            throw std::bad_alloc();
+        }
+        block_size_ = bytes;
+        block_alignment_ = alignment;
+        block_stride_ = roundUp(bytes < sizeof(FreeBlock) ? sizeof(FreeBlock) : bytes, getChunkAlignment());
+    }
+
+    FreeBlock *block = free_;
+    if (block == nullptr)
+    {
+        // Take over everything freed by the other threads at once - only the owner ever empties the stack
+        if (returned_.load(std::memory_order_relaxed) != nullptr)
+        {
+            block = returned_.exchange(nullptr, std::memory_order_acquire);
+        }
+        if (block == nullptr)
+        {
+            if (carve_ == carve_end_)
+            {
+                addChunk();
+            }
+            void *new_block = carve_;
+            carve_ += block_stride_;
+            carved_count_++;
+            return new_block;
+        }
+    }
+    free_ = block->next;
+    return block;
+}
+
+/**
+ * @brief gives a block back to the pool
+ *
+ * @param block returned by allocate()
+ * @note may be called from any thread, and destroys the pool if the owner has let go of it and block was the last
+ * live block
+ */
+inline void NodePool::deallocate(void *block) noexcept
+{
+    FreeBlock *freed = ::new (block) FreeBlock{nullptr};
+    FreeBlock *head = returned_.load(std::memory_order_relaxed);
+    do
+    {
+        if (head == abandonedMarker())
+        {
+            if (outstanding_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                destroy();
+            }
+            return;
+        }
+        freed->next = head;
+    } while (!returned_.compare_exchange_weak(head, freed, std::memory_order_release, std::memory_order_relaxed));
+}
+
+/**
+ * @brief lets go of the pool - it is destroyed once no block is live
+ *
+ * @pre only called by the owner, and only once - the pool must not be used to allocate afterwards
+ */
+inline void NodePool::abandon() noexcept
+{
+    // From here on frees count down outstanding_ instead of going on the stack
+    FreeBlock *returned = returned_.exchange(abandonedMarker(), std::memory_order_acq_rel);
+    std::ptrdiff_t live = static_cast<std::ptrdiff_t>(carved_count_ - countBlocks(free_) - countBlocks(returned));
+    if (live == 0 || outstanding_.fetch_add(live, std::memory_order_acq_rel) == -live)
+    {
+        destroy();
+    }
+}
+
+//********* PRIVATE METHODS **************//
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param upstream to allocate the chunks from
+ */
+inline NodePool::NodePool(std::pmr::memory_resource *upstream) noexcept : upstream_{upstream},
+                                                                         block_size_{0},
+                                                                         block_alignment_{0},
+                                                                         block_stride_{0},
+                                                                         free_{nullptr},
+                                                                         carve_{nullptr},
+                                                                         carve_end_{nullptr},
+                                                                         chunks_{nullptr},
+                                                                         next_chunk_blocks_{FIRST_CHUNK_BLOCKS_},
+                                                                         carved_count_{0},
+                                                                         returned_{nullptr},
+                                                                         outstanding_{0}
+{
+}
+
+/**
+ * @brief destructor - returns every chunk to the upstream resource
+ */
+inline NodePool::~NodePool()
+{
+    while (chunks_ != nullptr)
+    {
+        Chunk *next = chunks_->next;
+        upstream_->deallocate(chunks_, chunks_->bytes, getChunkAlignment());
+        chunks_ = next;
+    }
+}
+
+/**
+ * @brief allocates a new chunk and makes it the one blocks are carved from
+ *
+ * @throw std::bad_alloc if the upstream resource cannot allocate it
+ */
+inline void NodePool::addChunk()
+{
+    std::size_t header_size = roundUp(sizeof(Chunk), getChunkAlignment());
+    std::size_t bytes = header_size + next_chunk_blocks_ * block_stride_;
+    Chunk *chunk = ::new (upstream_->allocate(bytes, getChunkAlignment())) Chunk{chunks_, bytes};
+    chunks_ = chunk;
+    carve_ = reinterpret_cast<char *>(chunk) + header_size;
+    carve_end_ = carve_ + next_chunk_blocks_ * block_stride_;
+    if (next_chunk_blocks_ < MAX_CHUNK_BLOCKS_)
+    {
+        next_chunk_blocks_ *= 2;
+    }
+}
+
+/**
+ * @brief destroys the pool and returns its memory to the upstream resource
+ */
+inline void NodePool::destroy() noexcept
+{
+    std::pmr::memory_resource *upstream = upstream_;
+    this->~NodePool();
+    upstream->deallocate(this, sizeof(NodePool), alignof(NodePool));
+}
+
+/**
+ * @brief gets the value returned_ holds once the owner has let go - never the address of a block
+ *
+ * @return a pointer to the pool itself, as a FreeBlock pointer that is never dereferenced
+ */
+inline NodePool::FreeBlock *NodePool::abandonedMarker() noexcept
+{
+    return reinterpret_cast<FreeBlock *>(this);
+}
+
+/**
+ * @brief gets the alignment of every chunk, which is enough for both the chunk header and the blocks
+ *
+ * @return the larger of block_alignment_ and the alignment of a chunk header
+ */
+inline std::size_t NodePool::getChunkAlignment() const noexcept
+{
+    std::size_t header_alignment = alignof(Chunk) > alignof(FreeBlock) ? alignof(Chunk) : alignof(FreeBlock);
+    return block_alignment_ > header_alignment ? block_alignment_ : header_alignment;
+}
+
+/**
+ * @brief counts the blocks on a free list
+ *
+ * @param block the first block of the list
+ * @return the length of the list
+ */
+inline std::size_t NodePool::countBlocks(const FreeBlock *block) noexcept
+{
+    std::size_t count = 0;
+    for (; block != nullptr; block = block->next)
+    {
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief rounds size up to a multiple of alignment
+ *
+ * @param size to be rounded up
+ * @param alignment a power of two
+ * @return the smallest multiple of alignment that is at least size
+ */
+inline std::size_t NodePool::roundUp(const std::size_t &size, const std::size_t &alignment) noexcept
+{
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param pool to allocate from
+ */
+template <class ItemType>
+NodeAllocator<ItemType>::NodeAllocator(NodePool *pool) noexcept : pool_{pool}
+{
+}
+
+/**
+ * @brief converting constructor - used when the allocator is rebound, e.g. to a shared_ptr control block
+ *
+ * @param an_allocator whose pool is used
+ */
+template <class ItemType>
+template <class OtherType>
+NodeAllocator<ItemType>::NodeAllocator(const NodeAllocator<OtherType> &an_allocator) noexcept : pool_{an_allocator.getPool()}
+{
+}
+
+/**
+ * @brief allocates uninitialized storage for count objects
+ *
+ * @param count the number of objects - the pool only hands out one size, so always 1 in practice
+ * @return a pointer to the storage
+ */
+template <class ItemType>
+ItemType *NodeAllocator<ItemType>::allocate(std::size_t count)
+{
+    return static_cast<ItemType *>(pool_->allocate(count * sizeof(ItemType), alignof(ItemType)));
+}
+
+/**
+ * @brief returns storage to the pool
+ *
+ * @param storage returned by allocate()
+ * @param count passed to allocate()
+ */
+template <class ItemType>
+void NodeAllocator<ItemType>::deallocate(ItemType *storage, std::size_t) noexcept
+{
+    pool_->deallocate(storage);
+}
+
+/**
+ * @brief gets the pool the allocator allocates from
+ *
+ * @return a pointer to the pool
+ */
+template <class ItemType>
+NodePool *NodeAllocator<ItemType>::getPool() const noexcept
+{
+    return pool_;
+}
+
+/**
+ * @brief checks if two allocators allocate from the same pool
+ */
+template <class ItemType, class OtherType>
+bool operator==(const NodeAllocator<ItemType> &lhs, const NodeAllocator<OtherType> &rhs) noexcept
+{
+    return lhs.getPool() == rhs.getPool();
+}
+
+/**
+ * @brief checks if two allocators allocate from different pools
+ */
+template <class ItemType, class OtherType>
+bool operator!=(const NodeAllocator<ItemType> &lhs, const NodeAllocator<OtherType> &rhs) noexcept
+{
+    return !(lhs == rhs);
+}
@@ -0,0 +1,242 @@
+/**
+ * @file NodePool.hpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Interface for NodePool and NodeAllocator classes
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef NODE_POOL_
+#define NODE_POOL_
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+
+/**
+ * @brief A fixed-size slab pool for nodes - blocks of a single size are carved out of contiguous chunks, and freed
+ * blocks are threaded onto an intrusive free list to be handed out again
+ *
+ * @note One owner (the container that created the pool) allocates, without any synchronization. Blocks may be freed
+ * from any thread - a node can outlive its container, or move to another one by splice or move assignment - so a
+ * freed block is pushed onto a lock-free stack that the owner takes over in one go once its own free list runs dry
+ * @note The owner lets go with abandon(). The pool, and every chunk with it, is destroyed right away if no block is
+ * live, or otherwise by whichever thread frees the last live block
+ */
+class NodePool
+{
+public:
+    /**
+     * @brief creates a pool
+     *
+     * @param upstream to allocate the pool and its chunks from
+     * @return a pointer to the new pool, owned by the caller until it calls abandon()
+     */
+    static NodePool *create(std::pmr::memory_resource *upstream = std::pmr::get_default_resource());
+
+    NodePool(const NodePool &a_pool) = delete;
+    NodePool &operator=(const NodePool &a_pool) = delete;
+
+    /**
+     * @brief hands out a block - from the free list, from the blocks freed by other threads, or carved from a chunk
+     *
+     * @pre only called by the owner
+     * @param bytes the size of the block - every call must ask for the same size and alignment as the first one
+     * @param alignment of the block
+     * @throw std::bad_alloc if the chunk cannot be allocated, or bytes or alignment differ from the first call
+     * @return a pointer to the block
+     */
+    void *allocate(const std::size_t &bytes, const std::size_t &alignment);
+
+    /**
+     * @brief gives a block back to the pool
+     *
+     * @param block returned by allocate()
+     * @note may be called from any thread, and destroys the pool if the owner has let go of it and block was the last
+     * live block
+     */
+    void deallocate(void *block) noexcept;
+
+    /**
+     * @brief lets go of the pool - it is destroyed once no block is live
+     *
+     * @pre only called by the owner, and only once - the pool must not be used to allocate afterwards
+     */
+    void abandon() noexcept;
+
+private:
+    /**
+     * @brief a free block, linked through its own storage
+     */
+    struct FreeBlock
+    {
+        FreeBlock *next;
+    };
+
+    /**
+     * @brief the header at the start of every chunk
+     */
+    struct Chunk
+    {
+        Chunk *next;
+        std::size_t bytes;
+    };
+
+    // The first chunk holds this many blocks, and every later chunk twice as many as the one before, up to the maximum
+    static constexpr std::size_t FIRST_CHUNK_BLOCKS_ = 32;
+    static constexpr std::size_t MAX_CHUNK_BLOCKS_ = 4096;
+
+    std::pmr::memory_resource *upstream_;
+
+    // Fixed by the first allocation - 0 until then. Blocks sit block_stride_ bytes apart in their chunk
+    std::size_t block_size_;
+    std::size_t block_alignment_;
+    std::size_t block_stride_;
+
+    // Owner only: its free list, the unused tail of the newest chunk, and every chunk
+    FreeBlock *free_;
+    char *carve_;
+    char *carve_end_;
+    Chunk *chunks_;
+    std::size_t next_chunk_blocks_;
+
+    // Every block ever carved - the live blocks are those not on a free list
+    std::size_t carved_count_;
+
+    // Blocks freed since the owner last took them over, or abandonedMarker() once the owner has let go
+    std::atomic<FreeBlock *> returned_;
+
+    // Only used after abandon(): the owner adds the live block count and every later free subtracts one, in any order,
+    // so whoever brings it back to 0 destroys the pool
+    std::atomic<std::ptrdiff_t> outstanding_;
+
+    /**
+     * @brief parameterized constructor
+     *
+     * @param upstream to allocate the chunks from
+     */
+    explicit NodePool(std::pmr::memory_resource *upstream) noexcept;
+
+    /**
+     * @brief destructor - returns every chunk to the upstream resource
+     */
+    ~NodePool();
+
+    /**
+     * @brief allocates a new chunk and makes it the one blocks are carved from
+     *
+     * @throw std::bad_alloc if the upstream resource cannot allocate it
+     */
+    void addChunk();
+
+    /**
+     * @brief destroys the pool and returns its memory to the upstream resource
+     */
+    void destroy() noexcept;
+
+    /**
+     * @brief gets the value returned_ holds once the owner has let go - never the address of a block
+     *
+     * @return a pointer to the pool itself, as a FreeBlock pointer that is never dereferenced
+     */
+    FreeBlock *abandonedMarker() noexcept;
+
+    /**
+     * @brief gets the alignment of every chunk, which is enough for both the chunk header and the blocks
+     *
+     * @return the larger of block_alignment_ and the alignment of a chunk header
+     */
+    std::size_t getChunkAlignment() const noexcept;
+
+    /**
+     * @brief counts the blocks on a free list
+     *
+     * @param block the first block of the list
+     * @return the length of the list
+     */
+    static std::size_t countBlocks(const FreeBlock *block) noexcept;
+
+    /**
+     * @brief rounds size up to a multiple of alignment
+     *
+     * @param size to be rounded up
+     * @param alignment a power of two
+     * @return the smallest multiple of alignment that is at least size
+     */
+    static std::size_t roundUp(const std::size_t &size, const std::size_t &alignment) noexcept;
+};
+
+/**
+ * @brief An allocator that allocates from a NodePool, so that shared_ptr nodes and their control blocks come out of
+ * the pool
+ *
+ * @tparam ItemType of the objects to allocate
+ * @note Holds the pool by plain pointer - the pool outlives every block it handed out, so a node that outlives its
+ * container can still be freed to it
+ */
+template <class ItemType>
+class NodeAllocator
+{
+public:
+    using value_type = ItemType;
+
+    /**
+     * @brief parameterized constructor
+     *
+     * @param pool to allocate from
+     */
+    explicit NodeAllocator(NodePool *pool) noexcept;
+
+    /**
+     * @brief converting constructor - used when the allocator is rebound, e.g. to a shared_ptr control block
+     *
+     * @param an_allocator whose pool is used
+     */
+    template <class OtherType>
+    NodeAllocator(const NodeAllocator<OtherType> &an_allocator) noexcept;
+
+    /**
+     * @brief allocates uninitialized storage for count objects
+     *
+     * @param count the number of objects - the pool only hands out one size, so always 1 in practice
+     * @return a pointer to the storage
+     */
+    ItemType *allocate(std::size_t count);
+
+    /**
+     * @brief returns storage to the pool
+     *
+     * @param storage returned by allocate()
+     * @param count passed to allocate()
+     */
+    void deallocate(ItemType *storage, std::size_t count) noexcept;
+
+    /**
+     * @brief gets the pool the allocator allocates from
+     *
+     * @return a pointer to the pool
+     */
+    NodePool *getPool() const noexcept;
+
+private:
+    NodePool *pool_;
+};
+
+/**
+ * @brief checks if two allocators allocate from the same pool
+ */
+template <class ItemType, class OtherType>
+bool operator==(const NodeAllocator<ItemType> &lhs, const NodeAllocator<OtherType> &rhs) noexcept;
+
+/**
+ * @brief checks if two allocators allocate from different pools
+ */
+template <class ItemType, class OtherType>
+bool operator!=(const NodeAllocator<ItemType> &lhs, const NodeAllocator<OtherType> &rhs) noexcept;
+
+#include "NodePool.cpp"
+#endif
@@ -0,0 +1,177 @@
+/**
+ * @file BufferedWriter.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Implementation for BufferedWriter class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "BufferedWriter.hpp"
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param out the stream to write to, in blocks of up to buffer_size characters
+ * @param buffer_size the number of characters to collect before writing them
+ */
+inline BufferedWriter::BufferedWriter(std::ostream &out, const std::size_t &buffer_size) : BufferedWriter([&out](const char *data, std::size_t size)
+                                                                                                          { out.write(data, static_cast<std::streamsize>(size)); },
+                                                                                                          buffer_size)
+{
+}
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param sink to hand the formatted characters to, in blocks of up to buffer_size characters
+ * @param buffer_size the number of characters to collect before handing them over
+ */
+inline BufferedWriter::BufferedWriter(Sink sink, const std::size_t &buffer_size) : buffer_(std::move(sink), buffer_size), stream_(&buffer_)
+{
+    // Let a failing sink's exception through, instead of just setting badbit
+    stream_.exceptions(std::ios::badbit);
+}
+
+/**
+ * @brief destructor - hands whatever is still buffered to the sink
+ *
+ * @note an exception thrown by the sink here is swallowed - call flush() first to see it
+ */
+inline BufferedWriter::~BufferedWriter()
+{
+    try
+    {
+        flush();
+    }
+    catch (...)
+    {
+    }
+}
+
+/**
+ * @brief formats an item into the buffer
+ *
+ * @param item to be written
+ */
+template <class ItemType>
+void BufferedWriter::write(const ItemType &item)
+{
+    if constexpr (std::is_same_v<ItemType, bool>)
+    {
+        put(item ? '1' : '0');
+    }
+    else if constexpr (std::is_same_v<ItemType, char> || std::is_same_v<ItemType, signed char> || std::is_same_v<ItemType, unsigned char>)
+    {
+        // operator<< prints these as characters, not numbers
+        put(static_cast<char>(item));
+    }
+    else if constexpr (std::is_integral_v<ItemType>)
+    {
+        char *first = buffer_.reserve(MAX_NUMBER_LENGTH_);
+        buffer_.commit(std::to_chars(first, first + MAX_NUMBER_LENGTH_, item).ptr);
+    }
+    else if constexpr (std::is_floating_point_v<ItemType>)
+    {
+        // The general format with 6 significant digits is what operator<< uses by default
+        char *first = buffer_.reserve(MAX_NUMBER_LENGTH_);
+        buffer_.commit(std::to_chars(first, first + MAX_NUMBER_LENGTH_, item, std::chars_format::general, 6).ptr);
+    }
+    else
+    {
+        stream_ << item;
+    }
+}
+
+/**
+ * @brief writes a single character into the buffer
+ *
+ * @param character to be written
+ */
+inline void BufferedWriter::put(const char &character)
+{
+    char *next = buffer_.reserve(1);
+    *next = character;
+    buffer_.commit(next + 1);
+}
+
+/**
+ * @brief hands everything buffered so far to the sink
+ */
+inline void BufferedWriter::flush()
+{
+    buffer_.drain();
+}
+
+//********* PRIVATE METHODS **************//
+
+/**
+ * @brief parameterized constructor
+ *
+ * @param sink to hand the buffered characters to
+ * @param buffer_size the number of characters the buffer holds - at least MAX_NUMBER_LENGTH_
+ */
+inline BufferedWriter::Buffer::Buffer(Sink sink, const std::size_t &buffer_size) : sink_{std::move(sink)}
+{
+    std::size_t size = std::max(buffer_size, MAX_NUMBER_LENGTH_);
+    storage_ = std::make_unique<char[]>(size);
+    setp(storage_.get(), storage_.get() + size);
+}
+
+/**
+ * @brief makes room for some characters, handing the buffered ones to the sink if there is not enough
+ *
+ * @pre size <= MAX_NUMBER_LENGTH_
+ * @param size the number of characters to make room for
+ * @return a pointer to where the next character goes
+ */
+inline char *BufferedWriter::Buffer::reserve(const std::size_t &size)
+{
+    if (static_cast<std::size_t>(epptr() - pptr()) < size)
+    {
+        drain();
+    }
+    return pptr();
+}
+
+/**
+ * @brief marks the characters written after reserve() as buffered
+ *
+ * @param end one past the last character written
+ */
+inline void BufferedWriter::Buffer::commit(char *end)
+{
+    pbump(static_cast<int>(end - pptr()));
+}
+
+/**
+ * @brief hands the buffered characters to the sink and empties the buffer
+ */
+inline void BufferedWriter::Buffer::drain()
+{
+    if (pptr() != pbase())
+    {
+        sink_(pbase(), static_cast<std::size_t>(pptr() - pbase()));
+        setp(pbase(), epptr());
+    }
+}
+
+/**
+ * @brief called by the stream when the buffer is full - drains it and buffers character
+ *
+ * @param character to be buffered, or eof to just drain
+ * @return anything but eof, since it never fails without throwing
+ */
+inline BufferedWriter::Buffer::int_type BufferedWriter::Buffer::overflow(int_type character)
+{
+    drain();
+    if (traits_type::eq_int_type(character, traits_type::eof()))
+    {
+        return traits_type::not_eof(character);
+    }
+    *pptr() = traits_type::to_char_type(character);
+    pbump(1);
+    return character;
+}
@@ -0,0 +1,148 @@
+/**
+ * @file BufferedWriter.hpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Interface for BufferedWriter class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef BUFFERED_WRITER_
+#define BUFFERED_WRITER_
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <type_traits>
+
+/**
+ * @brief Formats items into one reusable buffer and hands it to a sink in large writes, for the containers' display
+ * methods
+ *
+ * @note Integers and floating point numbers are formatted with std::to_chars straight into the buffer. Any other item
+ * goes through its operator<<, into the same buffer - either way, writing an item never allocates
+ * @note Items are formatted as a default-constructed std::ostream would format them, whatever flags the target stream
+ * has set
+ * @note Nothing reaches the sink until the buffer fills up or flush() is called, and flush() never flushes the target
+ * stream itself
+ */
+class BufferedWriter
+{
+public:
+    // Receives a run of formatted characters
+    using Sink = std::function<void(const char *data, std::size_t size)>;
+
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE_ = 1 << 16;
+
+    /**
+     * @brief parameterized constructor
+     *
+     * @param out the stream to write to, in blocks of up to buffer_size characters
+     * @param buffer_size the number of characters to collect before writing them
+     */
+    explicit BufferedWriter(std::ostream &out, const std::size_t &buffer_size = DEFAULT_BUFFER_SIZE_);
+
+    /**
+     * @brief parameterized constructor
+     *
+     * @param sink to hand the formatted characters to, in blocks of up to buffer_size characters
+     * @param buffer_size the number of characters to collect before handing them over
+     */
+    explicit BufferedWriter(Sink sink, const std::size_t &buffer_size = DEFAULT_BUFFER_SIZE_);
+
+    BufferedWriter(const BufferedWriter &a_writer) = delete;
+    BufferedWriter &operator=(const BufferedWriter &a_writer) = delete;
+
+    /**
+     * @brief destructor - hands whatever is still buffered to the sink
+     *
+     * @note an exception thrown by the sink here is swallowed - call flush() first to see it
+     */
+    ~BufferedWriter();
+
+    /**
+     * @brief formats an item into the buffer
+     *
+     * @param item to be written
+     */
+    template <class ItemType>
+    void write(const ItemType &item);
+
+    /**
+     * @brief writes a single character into the buffer
+     *
+     * @param character to be written
+     */
+    void put(const char &character);
+
+    /**
+     * @brief hands everything buffered so far to the sink
+     */
+    void flush();
+
+private:
+    // Room for any integer in base 10, or any floating point number in the default format
+    static constexpr std::size_t MAX_NUMBER_LENGTH_ = 64;
+
+    /**
+     * @brief the buffer, as a stream buffer whose put area is the whole of it - so operator<< formats straight into it
+     */
+    class Buffer : public std::streambuf
+    {
+    public:
+        /**
+         * @brief parameterized constructor
+         *
+         * @param sink to hand the buffered characters to
+         * @param buffer_size the number of characters the buffer holds - at least MAX_NUMBER_LENGTH_
+         */
+        Buffer(Sink sink, const std::size_t &buffer_size);
+
+        /**
+         * @brief makes room for some characters, handing the buffered ones to the sink if there is not enough
+         *
+         * @pre size <= MAX_NUMBER_LENGTH_
+         * @param size the number of characters to make room for
+         * @return a pointer to where the next character goes
+         */
+        char *reserve(const std::size_t &size);
+
+        /**
+         * @brief marks the characters written after reserve() as buffered
+         *
+         * @param end one past the last character written
+         */
+        void commit(char *end);
+
+        /**
+         * @brief hands the buffered characters to the sink and empties the buffer
+         */
+        void drain();
+
+    protected:
+        /**
+         * @brief called by the stream when the buffer is full - drains it and buffers character
+         *
+         * @param character to be buffered, or eof to just drain
+         * @return anything but eof, since it never fails without throwing
+         */
+        int_type overflow(int_type character) override;
+
+    private:
+        Sink sink_;
+        std::unique_ptr<char[]> storage_;
+    };
+
+    Buffer buffer_;
+    // Formats the items with no to_chars fast path into buffer_
+    std::ostream stream_;
+};
+
+#include "BufferedWriter.cpp"
+#endif
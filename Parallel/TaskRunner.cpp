@@ -0,0 +1,199 @@
+/**
+ * @file TaskRunner.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Implementation for TaskRunner class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "TaskRunner.hpp"
+
+/**
+ * @brief calls task(0) ... task(task_count - 1), spread over the calling thread and up to task_count - 1 workers,
+ * and waits for all of them
+ *
+ * @param task_count the number of calls
+ * @param task to be called with the number of each task, from several threads at once
+ * @note if a task throws, the exception of the lowest-numbered task that threw is rethrown once every task has
+ * finished
+ * @note may be called from inside a task - the calling thread can always finish the tasks by itself
+ */
+template <class Task>
+void TaskRunner::run(const std::size_t &task_count, const Task &task)
+{
+    if (task_count == 0)
+    {
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(task_count);
+    auto run_task = [&](const std::size_t &task_number)
+    {
+        try
+        {
+            task(task_number);
+        }
+        catch (...)
+        {
+            errors[task_number] = std::current_exception();
+        }
+    };
+
+    if (task_count == 1)
+    {
+        run_task(0);
+    }
+    else
+    {
+        Batch batch{&callTask<decltype(run_task)>, &run_task, task_count, 0, 0};
+        getPool().run(batch);
+    }
+
+    for (const std::exception_ptr &error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+//********* PRIVATE METHODS **************//
+
+/**
+ * @brief runs every task of batch on the calling thread and any idle workers, and waits for all of them
+ *
+ * @param batch whose tasks are to be run - it is no longer referenced once this returns
+ */
+inline void TaskRunner::WorkerPool::run(Batch &batch)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    addWorkers(batch.task_count - 1);
+    batches_.push_back(&batch);
+
+    // Wake only as many workers as there are tasks to spare - the calling thread takes one itself
+    for (std::size_t woken = 1; woken < batch.task_count && woken <= worker_count_; woken++)
+    {
+        work_available_.notify_one();
+    }
+
+    while (runNextTask(batch, lock))
+    {
+    }
+
+    // Every task is claimed - wait for the workers still running one. A worker only joins a batch while it is queued,
+    // so once none is inside, none will touch it again
+    batch_finished_.wait(lock, [&batch]
+                         { return batch.workers_inside == 0; });
+}
+
+/**
+ * @brief starts workers until there are at least worker_count
+ *
+ * @pre mutex_ is held
+ * @param worker_count the number of workers wanted
+ * @note stops early, without throwing, if no new thread can be started
+ */
+inline void TaskRunner::WorkerPool::addWorkers(const std::size_t &worker_count)
+{
+    while (worker_count_ < worker_count)
+    {
+        try
+        {
+            std::thread(&WorkerPool::work, this).detach();
+        }
+        catch (const std::system_error &)
+        {
+            // Out of threads - make do with the workers there are
+            return;
+        }
+        worker_count_++;
+    }
+}
+
+/**
+ * @brief claims the next task of batch and runs it, with mutex_ released while it runs
+ *
+ * @pre mutex_ is held through lock
+ * @param batch to take the task from
+ * @param lock holding mutex_
+ * @return true if a task was run,
+ * @return false if every task of batch has been claimed
+ */
+inline bool TaskRunner::WorkerPool::runNextTask(Batch &batch, std::unique_lock<std::mutex> &lock)
+{
+    if (batch.next_task == batch.task_count)
+    {
+        return false;
+    }
+
+    std::size_t task_number = batch.next_task++;
+    if (batch.next_task == batch.task_count)
+    {
+        // Nothing left to hand out, so no other thread needs to find it
+        for (auto queued = batches_.begin(); queued != batches_.end(); ++queued)
+        {
+            if (*queued == &batch)
+            {
+                batches_.erase(queued);
+                break;
+            }
+        }
+    }
+
+    lock.unlock();
+    batch.call(batch.context, task_number);
+    lock.lock();
+    return true;
+}
+
+/**
+ * @brief the loop every worker runs - waits for a batch and helps with its tasks, forever
+ */
+inline void TaskRunner::WorkerPool::work()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        work_available_.wait(lock, [this]
+                             { return !batches_.empty(); });
+        Batch &batch = *batches_.front();
+        batch.workers_inside++;
+        while (runNextTask(batch, lock))
+        {
+        }
+        batch.workers_inside--;
+        if (batch.workers_inside == 0)
+        {
+            batch_finished_.notify_all();
+        }
+    }
+}
+
+/**
+ * @brief gets the pool, starting it on first use
+ *
+ * @return the pool - never destroyed, so that even a run from another static object's destructor works. Its idle
+ * workers end with the process
+ */
+inline TaskRunner::WorkerPool &TaskRunner::getPool()
+{
+    static WorkerPool *pool = new WorkerPool();
+    return *pool;
+}
+
+/**
+ * @brief calls the function context points to with task_number
+ *
+ * @tparam Function of the object context points to
+ * @param context pointer to the function object
+ * @param task_number to be passed to it
+ */
+template <class Function>
+void TaskRunner::callTask(const void *context, const std::size_t &task_number)
+{
+    (*static_cast<const Function *>(context))(task_number);
+}
@@ -0,0 +1,132 @@
+/**
+ * @file TaskRunner.hpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Interface for TaskRunner class
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef TASK_RUNNER_
+#define TASK_RUNNER_
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fans a fixed number of tasks out over a pool of worker threads and waits for all of them, for the containers'
+ * parallel searches and sorts
+ *
+ * @note The workers are started on first use and kept for the rest of the program, idle in between, so a run costs a
+ * hand-off instead of a thread start per task. The pool grows to the largest number of helpers ever asked for
+ * @note The calling thread takes tasks as well. If no new thread can be started, the threads already there - or the
+ * calling thread alone - run the tasks left over, so the work always gets done
+ */
+class TaskRunner
+{
+public:
+    /**
+     * @brief calls task(0) ... task(task_count - 1), spread over the calling thread and up to task_count - 1 workers,
+     * and waits for all of them
+     *
+     * @param task_count the number of calls
+     * @param task to be called with the number of each task, from several threads at once
+     * @note if a task throws, the exception of the lowest-numbered task that threw is rethrown once every task has
+     * finished
+     * @note may be called from inside a task - the calling thread can always finish the tasks by itself
+     */
+    template <class Task>
+    static void run(const std::size_t &task_count, const Task &task);
+
+private:
+    /**
+     * @brief one call to run() - its tasks are handed out one at a time to whichever thread asks next
+     */
+    struct Batch
+    {
+        // Calls the task with the given number - never throws
+        void (*call)(const void *context, const std::size_t &task_number);
+        const void *context;
+        std::size_t task_count;
+
+        // Guarded by the pool's mutex
+        std::size_t next_task;
+        std::size_t workers_inside;
+    };
+
+    /**
+     * @brief the worker threads and the batches waiting for them
+     */
+    class WorkerPool
+    {
+    public:
+        /**
+         * @brief runs every task of batch on the calling thread and any idle workers, and waits for all of them
+         *
+         * @param batch whose tasks are to be run - it is no longer referenced once this returns
+         */
+        void run(Batch &batch);
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable work_available_;
+        std::condition_variable batch_finished_;
+
+        // Batches with tasks nobody has claimed yet, oldest first
+        std::vector<Batch *> batches_;
+        std::size_t worker_count_ = 0;
+
+        /**
+         * @brief starts workers until there are at least worker_count
+         *
+         * @pre mutex_ is held
+         * @param worker_count the number of workers wanted
+         * @note stops early, without throwing, if no new thread can be started
+         */
+        void addWorkers(const std::size_t &worker_count);
+
+        /**
+         * @brief claims the next task of batch and runs it, with mutex_ released while it runs
+         *
+         * @pre mutex_ is held through lock
+         * @param batch to take the task from
+         * @param lock holding mutex_
+         * @return true if a task was run,
+         * @return false if every task of batch has been claimed
+         */
+        bool runNextTask(Batch &batch, std::unique_lock<std::mutex> &lock);
+
+        /**
+         * @brief the loop every worker runs - waits for a batch and helps with its tasks, forever
+         */
+        void work();
+    };
+
+    /**
+     * @brief gets the pool, starting it on first use
+     *
+     * @return the pool - never destroyed, so that even a run from another static object's destructor works. Its idle
+     * workers end with the process
+     */
+    static WorkerPool &getPool();
+
+    /**
+     * @brief calls the function context points to with task_number
+     *
+     * @tparam Function of the object context points to
+     * @param context pointer to the function object
+     * @param task_number to be passed to it
+     */
+    template <class Function>
+    static void callTask(const void *context, const std::size_t &task_number);
+};
+
+#include "TaskRunner.cpp"
+#endif
@@ -0,0 +1,153 @@
+/**
+ * @file concurrent_deque.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Throughput benchmark for ConcurrentDeque against a mutex-wrapped DoublyLinkedList
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * Build with optimizations on, e.g. g++ -std=c++17 -O2 concurrent_deque.cpp -o concurrent_deque -pthread
+ * and run as concurrent_deque [operations per thread]
+ *
+ * Runs the work queue pattern - half the threads push_back, the other half pop_front until every item is out - with
+ * 2 threads up to 16 or twice the hardware threads, whichever is more, and prints the pushes and pops per second of
+ * both queues. Any thread count past the number of cores measures lock hand-offs between time slices rather than
+ * contention
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../List/ConcurrentDeque.hpp"
+#include "../List/DoublyLinkedList.hpp"
+
+namespace
+{
+    /**
+     * @brief a DoublyLinkedList behind one mutex - the work queue ConcurrentDeque replaces
+     */
+    class LockedList
+    {
+    public:
+        /**
+         * @brief inserts an item at the end of the list
+         *
+         * @param new_element to be inserted
+         */
+        void push_back(const std::int64_t &new_element)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            list_.push_back(new_element);
+        }
+
+        /**
+         * @brief takes the first item out of the list
+         *
+         * @param item set to the first item, if there is one
+         * @return true if there was an item to take,
+         * @return false if the list was empty
+         */
+        bool pop_front(std::int64_t &item)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (list_.isEmpty())
+            {
+                return false;
+            }
+            item = list_.getItem(0);
+            list_.pop_front();
+            return true;
+        }
+
+    private:
+        std::mutex mutex_;
+        DoublyLinkedList<std::int64_t> list_;
+    };
+
+    /**
+     * @brief runs producer_count producers pushing item_count items each, and as many consumers taking them out
+     *
+     * @param queue to be measured
+     * @param producer_count the number of producers, and of consumers
+     * @param item_count the number of items each producer pushes
+     * @return the pushes and pops per second, in millions
+     */
+    template <class Queue>
+    double measure(Queue &queue, const int &producer_count, const std::int64_t &item_count)
+    {
+        std::int64_t total = producer_count * item_count;
+        std::atomic<std::int64_t> taken{0};
+        std::atomic<std::int64_t> checksum{0};
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producer_count; p++)
+        {
+            threads.emplace_back([&queue, &item_count, p]()
+                                 {
+                for (std::int64_t i = 0; i < item_count; i++)
+                {
+                    queue.push_back(p * item_count + i + 1);
+                } });
+            threads.emplace_back([&queue, &taken, &checksum, &total]()
+                                 {
+                std::int64_t item;
+                std::int64_t local_checksum = 0;
+                while (taken.load(std::memory_order_relaxed) < total)
+                {
+                    if (queue.pop_front(item))
+                    {
+                        local_checksum += item;
+                        taken.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+                checksum.fetch_add(local_checksum); });
+        }
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        if (checksum != total * (total + 1) / 2)
+        {
+            std::printf("checksum mismatch\n");
+            std::exit(1);
+        }
+        return 2.0 * static_cast<double>(total) / elapsed.count() / 1e6;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    std::int64_t operation_count = argc > 1 ? std::atoll(argv[1]) : 500000;
+    if (operation_count < 1)
+    {
+        std::printf("usage: %s [operations per thread]\n", argv[0]);
+        return 2;
+    }
+    int max_thread_count = 2 * static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    std::printf("%d hardware threads\n", static_cast<int>(std::thread::hardware_concurrency()));
+    std::printf("%-8s %16s %16s %9s\n", "threads", "deque Mops/s", "locked Mops/s", "speedup");
+    for (int thread_count = 2; thread_count <= std::max(max_thread_count, 16); thread_count *= 2)
+    {
+        ConcurrentDeque<std::int64_t> deque;
+        LockedList locked;
+        double deque_rate = measure(deque, thread_count / 2, operation_count);
+        double locked_rate = measure(locked, thread_count / 2, operation_count);
+        std::printf("%-8d %16.2f %16.2f %8.2fx\n", thread_count, deque_rate, locked_rate, deque_rate / locked_rate);
+    }
+    return 0;
+}
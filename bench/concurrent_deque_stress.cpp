@@ -0,0 +1,218 @@
+/**
+ * @file concurrent_deque_stress.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Stress test for ConcurrentDeque
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * Build with a sanitizer where one is available, e.g.
+ *     g++ -std=c++17 -O1 -g -fsanitize=thread concurrent_deque_stress.cpp -o concurrent_deque_stress -pthread
+ * and run as concurrent_deque_stress [producers] [consumers] [items per producer]
+ *
+ * Producers push unique items at both ends while consumers pop from both ends, then a mixed phase has every thread
+ * push and pop at once. Every item must come out exactly once - the test checks the item count, a checksum and a
+ * per-item flag, and exits with 1 on the first mismatch
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "../List/ConcurrentDeque.hpp"
+
+namespace
+{
+    /**
+     * @brief tallies the items taken out of the deque, from any number of threads
+     */
+    class Tally
+    {
+    public:
+        /**
+         * @brief parameterized constructor
+         *
+         * @param item_count the number of distinct items, numbered 1 to item_count
+         */
+        explicit Tally(const std::int64_t &item_count) : item_count_{item_count},
+                                                          seen_{std::make_unique<std::atomic<bool>[]>(item_count + 1)},
+                                                          taken_{0},
+                                                          checksum_{0},
+                                                          duplicate_{false}
+        {
+        }
+
+        /**
+         * @brief records an item taken out of the deque
+         *
+         * @param item taken
+         */
+        void take(const std::int64_t &item)
+        {
+            if (item < 1 || item > item_count_ || seen_[item].exchange(true, std::memory_order_relaxed))
+            {
+                duplicate_.store(true, std::memory_order_relaxed);
+            }
+            taken_.fetch_add(1, std::memory_order_relaxed);
+            checksum_.fetch_add(item, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief gets the number of items taken so far
+         *
+         * @return the number of calls to take()
+         */
+        std::int64_t getTakenCount() const
+        {
+            return taken_.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief checks that every item was taken exactly once, and prints what went wrong if not
+         *
+         * @param phase name printed with the result
+         * @return true if every item was taken exactly once,
+         * @return false otherwise
+         */
+        bool check(const char *phase) const
+        {
+            std::int64_t expected_checksum = item_count_ * (item_count_ + 1) / 2;
+            bool passed = !duplicate_ && taken_ == item_count_ && checksum_ == expected_checksum;
+            std::printf("%-8s %s: %lld of %lld items, checksum %lld (expected %lld)%s\n", phase, passed ? "ok" : "FAILED",
+                        static_cast<long long>(taken_.load()), static_cast<long long>(item_count_),
+                        static_cast<long long>(checksum_.load()), static_cast<long long>(expected_checksum),
+                        duplicate_ ? ", some item taken twice or unknown" : "");
+            return passed;
+        }
+
+    private:
+        std::int64_t item_count_;
+        std::unique_ptr<std::atomic<bool>[]> seen_;
+        std::atomic<std::int64_t> taken_;
+        std::atomic<std::int64_t> checksum_;
+        std::atomic<bool> duplicate_;
+    };
+
+    /**
+     * @brief producers push items 1 to producer_count * item_count at alternating ends, while consumers pop from
+     * alternating ends until every item is out
+     *
+     * @return true if every item came out exactly once
+     */
+    bool runProducersAndConsumers(const int &producer_count, const int &consumer_count, const std::int64_t &item_count)
+    {
+        std::int64_t total = producer_count * item_count;
+        ConcurrentDeque<std::int64_t> deque;
+        Tally tally(total);
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producer_count; p++)
+        {
+            threads.emplace_back([&deque, &item_count, p]()
+                                 {
+                for (std::int64_t i = 0; i < item_count; i++)
+                {
+                    std::int64_t item = p * item_count + i + 1;
+                    if ((i + p) % 2 == 0)
+                    {
+                        deque.push_back(item);
+                    }
+                    else
+                    {
+                        deque.push_front(item);
+                    }
+                } });
+        }
+        for (int c = 0; c < consumer_count; c++)
+        {
+            threads.emplace_back([&deque, &tally, &total, c]()
+                                 {
+                std::int64_t item;
+                for (std::int64_t i = c; tally.getTakenCount() < total; i++)
+                {
+                    if (i % 2 == 0 ? deque.pop_front(item) : deque.pop_back(item))
+                    {
+                        tally.take(item);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                } });
+        }
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+
+        std::int64_t item;
+        return tally.check("queue") && !deque.pop_front(item) && deque.isEmpty();
+    }
+
+    /**
+     * @brief every thread pushes its own items at alternating ends and pops one item for every two it pushes, then
+     * the leftovers are drained from a single thread
+     *
+     * @return true if every item came out exactly once
+     */
+    bool runMixed(const int &thread_count, const std::int64_t &item_count)
+    {
+        ConcurrentDeque<std::int64_t> deque;
+        Tally tally(thread_count * item_count);
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < thread_count; t++)
+        {
+            threads.emplace_back([&deque, &tally, &item_count, t]()
+                                 {
+                std::int64_t item;
+                for (std::int64_t i = 0; i < item_count; i++)
+                {
+                    std::int64_t new_item = t * item_count + i + 1;
+                    if ((i + t) % 2 == 0)
+                    {
+                        deque.push_back(new_item);
+                    }
+                    else
+                    {
+                        deque.push_front(new_item);
+                    }
+                    if (i % 2 == 1 && ((i / 2 + t) % 2 == 0 ? deque.pop_front(item) : deque.pop_back(item)))
+                    {
+                        tally.take(item);
+                    }
+                } });
+        }
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+
+        std::int64_t item;
+        while (deque.pop_back(item))
+        {
+            tally.take(item);
+        }
+        return tally.check("mixed") && deque.isEmpty();
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int producer_count = argc > 1 ? std::atoi(argv[1]) : 4;
+    int consumer_count = argc > 2 ? std::atoi(argv[2]) : 4;
+    std::int64_t item_count = argc > 3 ? std::atoll(argv[3]) : 100000;
+    if (producer_count < 1 || consumer_count < 1 || item_count < 1)
+    {
+        std::printf("usage: %s [producers] [consumers] [items per producer]\n", argv[0]);
+        return 2;
+    }
+
+    bool passed = runProducersAndConsumers(producer_count, consumer_count, item_count);
+    passed = runMixed(producer_count + consumer_count, item_count) && passed;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,194 @@
+/**
+ * @file node_pool.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Benchmark for NodePool against the std::make_shared nodes it replaced
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * Build with optimizations on, e.g. g++ -std=c++17 -O2 node_pool.cpp -o node_pool -pthread
+ * and run as node_pool [items] [repetitions]
+ *
+ * Builds a chain of items nodes the way DoublyLinkedList::push_back() links them, frees it the way clear() does, and
+ * builds it again - once with every node from std::make_shared, as the list did before it had a pool, and once from
+ * a NodePool. Then times DoublyLinkedList itself doing the same. Every time is the total over all the repetitions
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include "../List/DoublyLinkedList.hpp"
+#include "../Node/Node.hpp"
+#include "../Node/NodePool.hpp"
+
+namespace
+{
+    /**
+     * @brief the seconds spent in each phase
+     */
+    struct Timings
+    {
+        double fill = 0;
+        double clear = 0;
+        double refill = 0;
+    };
+
+    /**
+     * @brief gets the seconds elapsed since start
+     */
+    double secondsSince(const std::chrono::steady_clock::time_point &start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /**
+     * @brief a bare chain of nodes, linked and freed like the nodes of DoublyLinkedList
+     *
+     * @tparam MakeNode called as make_node(item), returning a std::shared_ptr<Node<int>>
+     */
+    template <class MakeNode>
+    class Chain
+    {
+    public:
+        /**
+         * @brief parameterized constructor
+         *
+         * @param make_node to make every node with
+         */
+        explicit Chain(MakeNode make_node) : make_node_{make_node}
+        {
+        }
+
+        /**
+         * @brief destructor - frees every node
+         */
+        ~Chain()
+        {
+            clear();
+        }
+
+        /**
+         * @brief links a new node in at the end of the chain
+         *
+         * @param item to be stored in the new node
+         */
+        void push_back(const int &item)
+        {
+            std::shared_ptr<Node<int>> new_node_ptr = make_node_(item);
+            if (first_ == nullptr)
+            {
+                first_ = new_node_ptr;
+            }
+            else
+            {
+                new_node_ptr->setPrevious(last_);
+                last_->setNext(new_node_ptr);
+            }
+            last_ = new_node_ptr;
+        }
+
+        /**
+         * @brief frees every node, one at a time
+         */
+        void clear()
+        {
+            while (first_ != nullptr)
+            {
+                std::shared_ptr<Node<int>> next = first_->getNext();
+                first_->setNext(nullptr);
+                first_ = next;
+            }
+            last_ = nullptr;
+        }
+
+    private:
+        MakeNode make_node_;
+        std::shared_ptr<Node<int>> first_;
+        std::shared_ptr<Node<int>> last_;
+    };
+
+    /**
+     * @brief fills, clears and refills a list of item_count items, repetitions times
+     *
+     * @param list to be measured - anything with push_back(int) and clear()
+     * @return the total seconds spent in each phase
+     */
+    template <class List>
+    Timings measure(List &list, const int &item_count, const int &repetitions)
+    {
+        Timings timings;
+        for (int repetition = 0; repetition < repetitions; repetition++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < item_count; i++)
+            {
+                list.push_back(i);
+            }
+            timings.fill += secondsSince(start);
+
+            start = std::chrono::steady_clock::now();
+            list.clear();
+            timings.clear += secondsSince(start);
+
+            start = std::chrono::steady_clock::now();
+            for (int i = 0; i < item_count; i++)
+            {
+                list.push_back(i);
+            }
+            timings.refill += secondsSince(start);
+            list.clear();
+        }
+        return timings;
+    }
+
+    /**
+     * @brief prints one row of the results
+     */
+    void print(const char *name, const Timings &timings, const Timings &baseline)
+    {
+        std::printf("%-18s %9.3f %6.2fx %9.3f %6.2fx %9.3f %6.2fx\n", name, timings.fill, baseline.fill / timings.fill,
+                    timings.clear, baseline.clear / timings.clear, timings.refill, baseline.refill / timings.refill);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int item_count = argc > 1 ? std::atoi(argv[1]) : 200000;
+    int repetitions = argc > 2 ? std::atoi(argv[2]) : 10;
+    if (item_count < 1 || repetitions < 1)
+    {
+        std::printf("usage: %s [items] [repetitions]\n", argv[0]);
+        return 2;
+    }
+
+    auto make_shared_node = [](const int &item)
+    {
+        return std::make_shared<Node<int>>(item);
+    };
+    Chain<decltype(make_shared_node)> shared_chain(make_shared_node);
+    Timings baseline = measure(shared_chain, item_count, repetitions);
+
+    NodePool *pool = NodePool::create();
+    auto make_pooled_node = [pool](const int &item)
+    {
+        return std::allocate_shared<Node<int>>(NodeAllocator<Node<int>>(pool), item);
+    };
+    Timings pooled;
+    {
+        Chain<decltype(make_pooled_node)> pooled_chain(make_pooled_node);
+        pooled = measure(pooled_chain, item_count, repetitions);
+    }
+    pool->abandon();
+
+    DoublyLinkedList<int> list;
+    Timings list_timings = measure(list, item_count, repetitions);
+
+    std::printf("%d items, %d repetitions - seconds, and speedup over make_shared\n", item_count, repetitions);
+    std::printf("%-18s %17s %17s %17s\n", "", "push_back", "clear", "refill");
+    print("make_shared chain", baseline, baseline);
+    print("NodePool chain", pooled, baseline);
+    print("DoublyLinkedList", list_timings, baseline);
+    return 0;
+}
@@ -0,0 +1,142 @@
+/**
+ * @file simd_search.cpp
+ * @author Alan Tuecci (Alan.Tuecci@hotmail.com)
+ * @brief Benchmark for the SimdSearch kernels against the plain loop they replaced
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * Build with optimizations on, e.g. g++ -std=c++17 -O2 simd_search.cpp -o simd_search
+ *
+ * Counts and looks up 32-bit keys in arrays from L1-resident up to DRAM-sized, and prints the throughput of the plain
+ * loop, of SimdSearch and the speedup. The small sizes measure the kernels themselves - at the largest size both
+ * loops wait on memory bandwidth instead
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "../Array/SimdSearch.hpp"
+
+// The reference loops are compiled with the same flags as the kernels, so the compiler is free to vectorize them -
+// the kernels have to beat whatever it makes of the plain loop. noinline only stops it from hoisting the search out
+// of the timing loop
+#if defined(__GNUC__) || defined(__clang__)
+#define REFERENCE_LOOP_ __attribute__((noinline))
+#else
+#define REFERENCE_LOOP_
+#endif
+
+namespace
+{
+    // Every run scans about this many entries, whatever the array size
+    constexpr std::int64_t ENTRIES_PER_RUN_ = std::int64_t{1} << 28;
+    // The best of this many runs is reported
+    constexpr int RUN_COUNT_ = 5;
+
+    /**
+     * @brief the loop ArrayBag::getFrequencyOf() ran before SimdSearch
+     */
+    REFERENCE_LOOP_ int frequencyOfScalar(const int *elements, int count, const int &target)
+    {
+        int frequency = 0;
+        int curr_index = 0;
+        while (curr_index < count)
+        {
+            if (elements[curr_index] == target)
+            {
+                frequency++;
+            }
+            curr_index++;
+        }
+        return frequency;
+    }
+
+    /**
+     * @brief the loop ArrayBag::getIndexOf() ran before SimdSearch
+     */
+    REFERENCE_LOOP_ int indexOfScalar(const int *elements, int count, const int &target)
+    {
+        bool found = false;
+        int result = -1;
+        int search_index = 0;
+        while (!found && (search_index < count))
+        {
+            if (elements[search_index] == target)
+            {
+                found = true;
+                result = search_index;
+            }
+            else
+            {
+                search_index++;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief runs search over the whole array again and again, and measures the best throughput
+     *
+     * @param elements to be searched
+     * @param search called as search(elements, count, target), returning an int
+     * @param target to be searched for
+     * @param checksum incremented by every result, so that no search is optimized away
+     * @return the best throughput in billions of entries per second
+     */
+    template <class Search>
+    double measure(const std::vector<int> &elements, Search search, const int &target, std::int64_t &checksum)
+    {
+        int count = static_cast<int>(elements.size());
+        std::int64_t repetitions = std::max<std::int64_t>(1, ENTRIES_PER_RUN_ / count);
+        double best = 0;
+        for (int run = 0; run < RUN_COUNT_; run++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (std::int64_t i = 0; i < repetitions; i++)
+            {
+                checksum += search(elements.data(), count, target);
+            }
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            best = std::max(best, static_cast<double>(repetitions * count) / elapsed.count() / 1e9);
+        }
+        return best;
+    }
+}
+
+int main()
+{
+    std::printf("%-10s %-8s %12s %12s %9s\n", "entries", "search", "plain G/s", "simd G/s", "speedup");
+
+    std::mt19937 generator(42);
+    std::int64_t scalar_checksum = 0;
+    std::int64_t simd_checksum = 0;
+    for (int count : {1 << 12, 1 << 15, 1 << 18, 1 << 24})
+    {
+        // Keys in [0, 1000), so that frequencyOf finds about count / 1000 matches and indexOf(-1) scans everything
+        std::vector<int> elements(count);
+        for (int &element : elements)
+        {
+            element = static_cast<int>(generator() % 1000);
+        }
+
+        double scalar = measure(elements, frequencyOfScalar, 7, scalar_checksum);
+        double simd = measure(elements, SimdSearch<int>::frequencyOf, 7, simd_checksum);
+        std::printf("%-10d %-8s %12.2f %12.2f %8.2fx\n", count, "count", scalar, simd, simd / scalar);
+
+        scalar = measure(elements, indexOfScalar, -1, scalar_checksum);
+        simd = measure(elements, SimdSearch<int>::indexOf, -1, simd_checksum);
+        std::printf("%-10d %-8s %12.2f %12.2f %8.2fx\n", count, "index", scalar, simd, simd / scalar);
+    }
+
+    if (scalar_checksum != simd_checksum)
+    {
+        std::printf("MISMATCH: plain %lld, simd %lld\n", static_cast<long long>(scalar_checksum), static_cast<long long>(simd_checksum));
+        return 1;
+    }
+    return 0;
+}